@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "json.hpp"
+
+#include "workspaces/file_manager_impl.h"
+#include "workspaces/wildcard.h"
+#include "workspaces/workspace.h"
+
+/*
+ * The batch analysis analyzes all programs defined in the pgm_conf.json of a HLASM workspace using multiple worker
+ *threads. Each worker owns one workspace which it reuses for all programs it analyzes, so macro and copy members are
+ *loaded from the disk once per worker instead of once per program. Directory listings of libraries are shared by all
+ *workers and the instruction tables are static. Parsed macro definitions are not shared, they refer to identifiers
+ *owned by the context of the program that processed them.
+ *
+ * The results are written to the standard output as JSON lines in the order in which the programs are finished,
+ *one line per program followed by a line with the totals.
+ *
+ * Accepted parameters:
+ *  -p - path to the folder with .hlasmplugin, current directory by default
+ *  -j - number of worker threads, number of hardware threads by default
+ *  -f - exit with code 2 if any program has an error diagnostic
+ * Exits with code 1 if a program could not be read or the analyzer crashed.
+ * Program line:
+ * - File                     - program file relative to the workspace folder
+ * - Success                  - false if the program could not be read or the analyzer crashed
+ * - Errors, Warnings         - number of error and warning diagnostics
+ * - Wall Time (ms)           - duration of the analysis of the program
+ * - Diagnostics              - list of diagnostics with File, Line, Column, Severity, Code and Message
+ * - statement counts as collected by the benchmark
+ * Totals line:
+ * - Total                    - Programs, Errors, Warnings, Analyzer crashes, Failed program opens, Workers, Time (ms)
+ */
+
+using json = nlohmann::json;
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+// directory listings shared by file managers of all workers
+class directory_cache
+{
+public:
+    template<typename F> std::unordered_map<std::string, std::string> get(const std::string& path, F&& list)
+    {
+        {
+            std::lock_guard guard(mtx_);
+            if (auto found = listings_.find(path); found != listings_.end())
+                return found->second;
+        }
+        // workers may list the same directory concurrently, the first listing wins
+        auto listing = list();
+        std::lock_guard guard(mtx_);
+        return listings_.emplace(path, std::move(listing)).first->second;
+    }
+
+private:
+    std::mutex mtx_;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> listings_;
+};
+
+class batch_file_manager : public workspaces::file_manager_impl
+{
+public:
+    explicit batch_file_manager(directory_cache& cache)
+        : cache_(cache)
+    {}
+
+    std::unordered_map<std::string, std::string> list_directory_files(const std::string& path) override
+    {
+        return cache_.get(path, [this, &path]() { return file_manager_impl::list_directory_files(path); });
+    }
+
+private:
+    directory_cache& cache_;
+};
+
+struct batch_stats
+{
+    std::atomic<size_t> program_count = 0;
+    std::atomic<size_t> error_count = 0;
+    std::atomic<size_t> warning_count = 0;
+    std::atomic<size_t> parsing_crashes = 0;
+    std::atomic<size_t> failed_file_opens = 0;
+};
+
+const char* severity_name(diagnostic_severity severity)
+{
+    switch (severity)
+    {
+        case diagnostic_severity::error:
+            return "error";
+        case diagnostic_severity::warning:
+            return "warning";
+        case diagnostic_severity::info:
+            return "info";
+        case diagnostic_severity::hint:
+            return "hint";
+        default:
+            return "unspecified";
+    }
+}
+
+json metrics_to_json(const performance_metrics& metrics)
+{
+    return json({ { "Open Code Statements", metrics.open_code_statements },
+        { "Copy Statements", metrics.copy_statements },
+        { "Macro Statements", metrics.macro_statements },
+        { "Copy Def Statements", metrics.copy_def_statements },
+        { "Macro Def Statements", metrics.macro_def_statements },
+        { "Lookahead Statements", metrics.lookahead_statements },
+        { "Reparsed Statements", metrics.reparsed_statements },
+        { "Continued Statements", metrics.continued_statements },
+        { "Non-continued Statements", metrics.non_continued_statements },
+        { "Lines", metrics.lines },
+        { "Files", metrics.files } });
+}
+
+json analyze_program(workspaces::workspace& ws,
+    workspaces::file_manager_impl& fm,
+    const std::string& ws_folder,
+    const std::string& program,
+    batch_stats& s)
+{
+    auto path = ws_folder + "/" + program;
+    auto file = fm.add_processor_file(path);
+    if (file->update_and_get_bad())
+    {
+        fm.remove_file(path);
+        ++s.failed_file_opens;
+        return json({ { "File", program }, { "Success", false }, { "Reason", "Read error" } });
+    }
+    ++s.program_count;
+
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        ws.parse_file(path);
+    }
+    catch (const std::exception& e)
+    {
+        fm.remove_file(path);
+        ++s.parsing_crashes;
+        return json({ { "File", program }, { "Success", false }, { "Reason", "Crash" }, { "Error", e.what() } });
+    }
+    catch (...)
+    {
+        fm.remove_file(path);
+        ++s.parsing_crashes;
+        return json({ { "File", program }, { "Success", false }, { "Reason", "Crash" } });
+    }
+    auto time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    size_t errors = 0;
+    size_t warnings = 0;
+    json diags = json::array();
+    for (const auto& d : file->diags())
+    {
+        if (d.severity == diagnostic_severity::error)
+            ++errors;
+        else if (d.severity == diagnostic_severity::warning)
+            ++warnings;
+        diags.push_back({ { "File", d.file_name },
+            { "Line", d.diag_range.start.line },
+            { "Column", d.diag_range.start.column },
+            { "Severity", severity_name(d.severity) },
+            { "Code", d.code },
+            { "Message", d.message } });
+    }
+    s.error_count += errors;
+    s.warning_count += warnings;
+
+    json result({ { "File", program },
+        { "Success", true },
+        { "Errors", errors },
+        { "Warnings", warnings },
+        { "Wall Time (ms)", time } });
+    result.update(metrics_to_json(file->get_metrics()));
+    result["Diagnostics"] = std::move(diags);
+
+    // analyzers of the dependencies refer to the context of the program, so they must not outlive it
+    // the files themselves stay loaded for the following programs
+    for (const auto& dependency : file->dependencies())
+        if (auto dependency_file = fm.find_processor_file(dependency))
+            dependency_file->evict();
+    fm.remove_file(path);
+
+    return result;
+}
+
+// returns programs defined in pgm_conf.json relative to the workspace folder, wildcards are expanded
+std::vector<std::string> list_programs(const json& programs, const std::string& ws_folder)
+{
+    std::vector<std::string> result;
+    std::unordered_set<std::string> seen;
+    std::vector<workspaces::wildcard> wildcards;
+    for (const auto& program : programs)
+    {
+        if (program.find("program") == program.end())
+        {
+            std::clog << "Malformed json" << std::endl;
+            continue;
+        }
+        auto name = program["program"].get<std::string>();
+#ifdef _WIN32
+        // change of forward slash to backslash on windows
+        std::replace(name.begin(), name.end(), '/', '\\');
+#endif
+        if (workspaces::is_wildcard(name))
+            wildcards.emplace_back(name);
+        else if (seen.insert(name).second)
+            result.push_back(name);
+    }
+
+    if (wildcards.empty())
+        return result;
+
+    std::error_code ec;
+    std::filesystem::path ws_path(ws_folder);
+    for (std::filesystem::recursive_directory_iterator it(ws_path, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if (!it->is_regular_file(ec))
+            continue;
+        auto name = it->path().lexically_relative(ws_path).lexically_normal().string();
+        if (std::any_of(wildcards.begin(), wildcards.end(), [&name](const auto& w) { return w.match(name); })
+            && seen.insert(name).second)
+            result.push_back(name);
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string ws_folder = std::filesystem::current_path().string();
+    size_t workers = std::max(1U, std::thread::hardware_concurrency());
+    bool fail_on_errors = false;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        // path parameter, path to the folder containing .hlasmplugin
+        if (arg == "-p" && i + 1 < argc)
+        {
+            ws_folder = argv[i + 1];
+            i++;
+        }
+        // number of worker threads
+        else if (arg == "-j" && i + 1 < argc)
+        {
+            try
+            {
+                workers = std::stoul(argv[i + 1]);
+            }
+            catch (...)
+            {
+                workers = 0;
+            }
+            if (workers == 0)
+            {
+                std::clog << "Number of workers must be a positive integer" << '\n';
+                return 1;
+            }
+            i++;
+        }
+        // exit code switch, when specified, error diagnostics fail the analysis
+        else if (arg == "-f")
+        {
+            fail_on_errors = true;
+        }
+        else
+        {
+            std::clog << "Unknown parameter " << arg << '\n';
+            return 1;
+        }
+    }
+
+    auto conf_path = ws_folder + "/.hlasmplugin/pgm_conf.json";
+
+    std::ifstream in(conf_path);
+    if (in.fail())
+    {
+        std::clog << "Non existing config: " << conf_path << '\n';
+        return 1;
+    }
+
+    std::vector<std::string> programs;
+    try
+    {
+        std::string conf((std::istreambuf_iterator<char>(in)), (std::istreambuf_iterator<char>()));
+        programs = list_programs(json::parse(conf)["pgms"], ws_folder);
+    }
+    catch (...)
+    {
+        std::clog << "Malformed json" << std::endl;
+        return 1;
+    }
+
+    workers = std::min(workers, std::max<size_t>(programs.size(), 1));
+
+    directory_cache cache;
+    batch_stats s;
+    std::atomic<size_t> next_program = 0;
+    std::mutex output_mtx;
+
+    auto start = std::chrono::steady_clock::now();
+
+    auto worker = [&]() {
+        batch_file_manager fm(cache);
+        workspaces::workspace ws(ws_folder, fm);
+        ws.open();
+
+        for (size_t i = next_program++; i < programs.size(); i = next_program++)
+        {
+            auto line = analyze_program(ws, fm, ws_folder, programs[i], s).dump();
+
+            std::lock_guard guard(output_mtx);
+            std::cout << line << std::endl;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < workers; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads)
+        t.join();
+
+    auto time =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << json({ { "Total",
+                            { { "Programs", s.program_count.load() },
+                                { "Errors", s.error_count.load() },
+                                { "Warnings", s.warning_count.load() },
+                                { "Analyzer crashes", s.parsing_crashes.load() },
+                                { "Failed program opens", s.failed_file_opens.load() },
+                                { "Workers", workers },
+                                { "Time (ms)", time } } } })
+                     .dump()
+              << std::endl;
+
+    if (s.parsing_crashes > 0 || s.failed_file_opens > 0)
+        return 1;
+    if (fail_on_errors && s.error_count > 0)
+        return 2;
+    return 0;
+}
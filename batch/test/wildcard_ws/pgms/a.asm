@@ -0,0 +1 @@
+         MAC   1
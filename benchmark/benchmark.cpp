@@ -49,6 +49,21 @@
  * - Continued Statements     - number of statements that were continued (multiple continuations of one statement count
  *as one continued statement)
  * - Non-continued Statements - number of statements that were not continued
+ * - SLL Statements           - number of operand fields parsed with the fast SLL prediction
+ * - LL Fallback Statements   - number of operand fields that failed with SLL prediction and were parsed again with LL
+ * - Token Buffer Peak        - largest number of tokens buffered at once by the open code token stream
+ * - Retained Tokens          - number of tokens kept after their statement was processed (referenced from parse trees)
+ * - <Phase> Time (ms)        - time spent in the phase of the analysis (lexing, parsing, reparsing, processing,
+ *CA evaluation, library, lookahead, postponed checking, LSP processing), excluding the phases nested in it
+ * - Library Lookups          - number of macro and copy members looked up in libraries
+ * - Lookaheads               - number of started lookaheads
+ * - Postponed Statements     - number of statements checked after the end of the open code
+ * - Identifiers              - number of identifiers stored permanently in the context
+ * - Identifiers Peak         - largest number of identifiers held at once, including scratch identifiers of generated
+ *names
+ * - Identifier Memory (KB)   - estimated memory held by the identifiers
+ * - <Kind> Memory (KB)       - estimated memory held by the analysis of the file with its macros and copy members
+ *(context, LSP, highlighting, tokens, cached statements and total)
  * - Lines                    - total number of lines
  * - ExecStatement/ms         - ExecStatements includes open code, macro, copy, lookahead and reparsed statements
  * - Line/ms
@@ -98,6 +113,12 @@ struct all_file_stats
     size_t failed_file_opens = 0;
 };
 
+// converts phase time of performance metrics to milliseconds
+double ms(size_t nanoseconds) { return nanoseconds / 1000000.0; }
+
+// converts estimated memory to kilobytes
+double kb(size_t bytes) { return bytes / 1024.0; }
+
 json parse_one_file(const std::string& source_file,
     const std::string& ws_folder,
     all_file_stats& s,
@@ -154,6 +175,11 @@ json parse_one_file(const std::string& source_file,
     auto exec_statements = collector.metrics_.open_code_statements + collector.metrics_.copy_statements
         + collector.metrics_.macro_statements + collector.metrics_.lookahead_statements
         + collector.metrics_.reparsed_statements;
+    // memory held by the analysis of the program and of the macros and copy members it uses
+    hlasm_plugin::parser_library::memory_usage memory;
+    auto usages = ws.memory_usage();
+    for (size_t i = 0; i < usages.size(); ++i)
+        memory += usages.item(i).usage;
     s.average_stmt_ms += (exec_statements / (double)time);
     s.average_line_ms += collector.metrics_.lines / (double)time;
     s.all_files += collector.metrics_.files;
@@ -171,6 +197,31 @@ json parse_one_file(const std::string& source_file,
                   << "Reparsed Statements: " << collector.metrics_.reparsed_statements << '\n'
                   << "Continued Statements: " << collector.metrics_.continued_statements << '\n'
                   << "Non-continued Statements: " << collector.metrics_.non_continued_statements << '\n'
+                  << "SLL Statements: " << collector.metrics_.sll_statements << '\n'
+                  << "LL Fallback Statements: " << collector.metrics_.ll_fallback_statements << '\n'
+                  << "Token Buffer Peak: " << collector.metrics_.token_buffer_peak << '\n'
+                  << "Retained Tokens: " << collector.metrics_.retained_tokens << '\n'
+                  << "Lexing Time: " << ms(collector.metrics_.lexing_time) << " ms" << '\n'
+                  << "Parsing Time: " << ms(collector.metrics_.parsing_time) << " ms" << '\n'
+                  << "Reparsing Time: " << ms(collector.metrics_.reparsing_time) << " ms" << '\n'
+                  << "Processing Time: " << ms(collector.metrics_.processing_time) << " ms" << '\n'
+                  << "CA Evaluation Time: " << ms(collector.metrics_.ca_evaluation_time) << " ms" << '\n'
+                  << "Library Time: " << ms(collector.metrics_.library_time) << " ms" << '\n'
+                  << "Lookahead Time: " << ms(collector.metrics_.lookahead_time) << " ms" << '\n'
+                  << "Postponed Checking Time: " << ms(collector.metrics_.postponed_checking_time) << " ms" << '\n'
+                  << "LSP Processing Time: " << ms(collector.metrics_.lsp_processing_time) << " ms" << '\n'
+                  << "Library Lookups: " << collector.metrics_.library_lookups << '\n'
+                  << "Lookaheads: " << collector.metrics_.lookaheads << '\n'
+                  << "Postponed Statements: " << collector.metrics_.postponed_statements << '\n'
+                  << "Identifiers: " << collector.metrics_.identifiers << '\n'
+                  << "Identifiers Peak: " << collector.metrics_.identifiers_peak << '\n'
+                  << "Identifier Memory: " << kb(collector.metrics_.identifier_memory) << " KB" << '\n'
+                  << "Context Memory: " << kb(memory.context) << " KB" << '\n'
+                  << "LSP Memory: " << kb(memory.lsp) << " KB" << '\n'
+                  << "Highlighting Memory: " << kb(memory.highlighting) << " KB" << '\n'
+                  << "Token Memory: " << kb(memory.tokens) << " KB" << '\n'
+                  << "Cached Statements Memory: " << kb(memory.cached_statements) << " KB" << '\n'
+                  << "Total Memory: " << kb(memory.total()) << " KB" << '\n'
                   << "Lines: " << collector.metrics_.lines << '\n'
                   << "Executed Statement/ms: " << exec_statements / (double)time << '\n'
                   << "Line/ms: " << collector.metrics_.lines / (double)time << '\n'
@@ -192,6 +243,31 @@ json parse_one_file(const std::string& source_file,
         { "Reparsed Statements", collector.metrics_.reparsed_statements },
         { "Continued Statements", collector.metrics_.continued_statements },
         { "Non-continued Statements", collector.metrics_.non_continued_statements },
+        { "SLL Statements", collector.metrics_.sll_statements },
+        { "LL Fallback Statements", collector.metrics_.ll_fallback_statements },
+        { "Token Buffer Peak", collector.metrics_.token_buffer_peak },
+        { "Retained Tokens", collector.metrics_.retained_tokens },
+        { "Lexing Time (ms)", ms(collector.metrics_.lexing_time) },
+        { "Parsing Time (ms)", ms(collector.metrics_.parsing_time) },
+        { "Reparsing Time (ms)", ms(collector.metrics_.reparsing_time) },
+        { "Processing Time (ms)", ms(collector.metrics_.processing_time) },
+        { "CA Evaluation Time (ms)", ms(collector.metrics_.ca_evaluation_time) },
+        { "Library Time (ms)", ms(collector.metrics_.library_time) },
+        { "Lookahead Time (ms)", ms(collector.metrics_.lookahead_time) },
+        { "Postponed Checking Time (ms)", ms(collector.metrics_.postponed_checking_time) },
+        { "LSP Processing Time (ms)", ms(collector.metrics_.lsp_processing_time) },
+        { "Library Lookups", collector.metrics_.library_lookups },
+        { "Lookaheads", collector.metrics_.lookaheads },
+        { "Postponed Statements", collector.metrics_.postponed_statements },
+        { "Identifiers", collector.metrics_.identifiers },
+        { "Identifiers Peak", collector.metrics_.identifiers_peak },
+        { "Identifier Memory (KB)", kb(collector.metrics_.identifier_memory) },
+        { "Context Memory (KB)", kb(memory.context) },
+        { "LSP Memory (KB)", kb(memory.lsp) },
+        { "Highlighting Memory (KB)", kb(memory.highlighting) },
+        { "Token Memory (KB)", kb(memory.tokens) },
+        { "Cached Statements Memory (KB)", kb(memory.cached_statements) },
+        { "Total Memory (KB)", kb(memory.total()) },
         { "Executed Statements", exec_statements },
         { "Lines", collector.metrics_.lines },
         { "ExecStatement/ms", exec_statements / (double)time },
@@ -42,6 +42,11 @@ export async function activate(context: vscode.ExtensionContext) {
             code2Protocol: (value: vscode.Uri) => value.toString(),
             protocol2Code: (value: string) =>
                 vscode.Uri.file((vscode.Uri.parse(value).fsPath))
+        },
+        initializationOptions: {
+            memoryBudget: getConfig<number>('memoryBudget', 0),
+            checkingThreads: getConfig<number>('checkingThreads', 1),
+            storagePath: context.storagePath
         }
     };
 
@@ -0,0 +1,30 @@
+# Copyright (c) 2019 Broadcom.
+# The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+#
+# This program and the accompanying materials are made
+# available under the terms of the Eclipse Public License 2.0
+# which is available at https://www.eclipse.org/legal/epl-2.0/
+#
+# SPDX-License-Identifier: EPL-2.0
+#
+# Contributors:
+#   Broadcom, Inc. - initial API and implementation
+
+cmake_minimum_required (VERSION 3.10)
+
+
+project(googlebenchmark-download NONE)
+
+set(GBENCH_EXTERNAL_ROOT ${CMAKE_BINARY_DIR}/externals/googlebenchmark)
+
+include(ExternalProject)
+ExternalProject_Add(googlebenchmark
+  GIT_REPOSITORY    https://github.com/google/benchmark.git
+  GIT_TAG           v1.5.2
+  SOURCE_DIR        ${CMAKE_BINARY_DIR}/googlebenchmark-src
+  BINARY_DIR        ${CMAKE_BINARY_DIR}/googlebenchmark-build
+  CONFIGURE_COMMAND ""
+  BUILD_COMMAND     ""
+  INSTALL_COMMAND   ""
+  TEST_COMMAND      ""
+)
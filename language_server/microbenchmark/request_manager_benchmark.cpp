@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+
+#include "lsp/lsp_server.h"
+#include "request_manager.h"
+#include "workspace_manager.h"
+
+// replay of a user typing into an open document followed by a hover request
+// reports how many parses were started per keystroke, the time between
+// the last keystroke and the response to the hover request and the mean
+// time the requests of each priority class waited in the queue
+
+using namespace hlasm_plugin;
+using namespace hlasm_plugin::language_server;
+
+namespace {
+
+const std::string document_uri = "file:///c%3A/bench/typing.hlasm";
+
+std::string make_document(size_t lines)
+{
+    std::string text = R"(         MACRO
+         MAC   &P
+         LR    &P,&P
+         MEND
+)";
+    for (size_t i = 0; i < lines; ++i)
+        text.append("LBL").append(std::to_string(i)).append("   MAC   ").append(std::to_string(i % 16)).append("\n");
+    return text;
+}
+
+json make_notification(std::string method_name, json parameter)
+{
+    return { { "jsonrpc", "2.0" }, { "method", method_name }, { "params", parameter } };
+}
+
+json make_keystroke(int version, int column)
+{
+    return make_notification("textDocument/didChange",
+        { { "textDocument", { { "uri", document_uri }, { "version", version } } },
+            { "contentChanges",
+                json::array({ { { "range",
+                                    { { "start", { { "line", 1 }, { "character", column } } },
+                                        { "end", { { "line", 1 }, { "character", column } } } } },
+                    { "rangeLength", 0 },
+                    { "text", "X" } } }) } });
+}
+
+json make_hover(int id)
+{
+    return { { "jsonrpc", "2.0" },
+        { "id", id },
+        { "method", "textDocument/hover" },
+        { "params",
+            { { "textDocument", { { "uri", document_uri } } },
+                { "position", { { "line", 5 }, { "character", 10 } } } } } };
+}
+
+// lsp server that counts executed didChange notifications
+class counting_server : public lsp::server
+{
+public:
+    counting_server(parser_library::workspace_manager& ws_mngr)
+        : lsp::server(ws_mngr)
+    {}
+
+    void message_received(const json& message) override
+    {
+        if (message.value("method", "") == "textDocument/didChange")
+            ++parses;
+        lsp::server::message_received(message);
+    }
+
+    std::atomic<size_t> parses = 0;
+};
+
+// waits for the response to the request with the specified id
+class response_waiter : public send_message_provider
+{
+public:
+    void reply(const json& result) override
+    {
+        if (result.find("id") == result.end())
+            return;
+        std::lock_guard guard(mtx_);
+        responded_ = std::chrono::steady_clock::now();
+        received_ = true;
+        cond_.notify_one();
+    }
+
+    std::chrono::steady_clock::time_point wait()
+    {
+        std::unique_lock lock(mtx_);
+        cond_.wait(lock, [this] { return received_; });
+        received_ = false;
+        return responded_;
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cond_;
+    bool received_ = false;
+    std::chrono::steady_clock::time_point responded_;
+};
+
+// arguments: number of keystrokes, milliseconds between keystrokes, debounce period in milliseconds
+void typing_replay(benchmark::State& state)
+{
+    const auto keystrokes = (int)state.range(0);
+    const auto typing_interval = std::chrono::milliseconds(state.range(1));
+    const auto debounce = std::chrono::milliseconds(state.range(2));
+    const auto document = make_document(1000);
+
+    size_t parses = 0;
+    std::array<queue_wait_stats, request_priority_count> waits;
+    for (auto _ : state)
+    {
+        std::atomic<bool> cancel = false;
+        parser_library::workspace_manager ws_mngr(&cancel);
+        response_waiter waiter;
+        counting_server s(ws_mngr);
+        s.set_send_message_provider(&waiter);
+        request_manager req_mngr(&cancel, debounce);
+
+        s.message_received(make_notification("textDocument/didOpen",
+            { { "textDocument",
+                { { "uri", document_uri }, { "languageId", "hlasm" }, { "version", 1 }, { "text", document } } } }));
+
+        for (int i = 0; i < keystrokes; ++i)
+        {
+            req_mngr.add_request(&s, make_keystroke(i + 2, 10 + i));
+            if (i + 1 < keystrokes)
+                std::this_thread::sleep_for(typing_interval);
+        }
+        auto last_keystroke = std::chrono::steady_clock::now();
+        req_mngr.add_request(&s, make_hover(1));
+
+        auto responded = waiter.wait();
+        state.SetIterationTime(std::chrono::duration<double>(responded - last_keystroke).count());
+
+        req_mngr.end_worker();
+        parses += s.parses;
+        auto stats = req_mngr.wait_stats();
+        for (size_t i = 0; i < request_priority_count; ++i)
+        {
+            waits[i].count += stats[i].count;
+            waits[i].total += stats[i].total;
+        }
+    }
+
+    state.counters["parses_per_keystroke"] = (double)parses / (double)(state.iterations() * keystrokes);
+    const char* wait_names[request_priority_count] = { "active_wait_us", "open_wait_us", "background_wait_us" };
+    for (size_t i = 0; i < request_priority_count; ++i)
+        if (waits[i].count)
+            state.counters[wait_names[i]] = (double)waits[i].total.count() / (double)waits[i].count;
+}
+BENCHMARK(typing_replay)
+    ->Args({ 20, 0, 0 })
+    ->Args({ 20, 0, 200 })
+    ->Args({ 20, 20, 0 })
+    ->Args({ 20, 20, 200 })
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -173,8 +173,11 @@ void feature_launch::on_step_in(const json& request_seq, const json&)
 void feature_launch::on_variables(const json& request_seq, const json& args)
 {
     auto var_ref = args["variablesReference"];
+    // clients request children of large arrays in pages
+    size_t start = args.value("start", (size_t)0);
+    size_t count = args.value("count", (size_t)0);
 
-    parser_library::variables vars = ws_mngr_.get_variables(var_ref);
+    parser_library::variables vars = ws_mngr_.get_variables(var_ref, start, count);
 
     json variables_json = json::array();
 
@@ -212,6 +215,11 @@ void feature_launch::on_variables(const json& request_seq, const json& args)
                 { "variablesReference", var.variable_reference() },
                 { "type", type } };
 
+        if (auto indexed = var.indexed_variables())
+            var_json["indexedVariables"] = indexed;
+        if (auto named = var.named_variables())
+            var_json["namedVariables"] = named;
+
         variables_json.push_back(std::move(var_json));
     }
 
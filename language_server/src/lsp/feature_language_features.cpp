@@ -15,6 +15,7 @@
 
 #include "feature_language_features.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "../feature.h"
@@ -37,15 +38,22 @@ void feature_language_features::register_methods(std::map<std::string, method>&
         std::bind(&feature_language_features::hover, this, std::placeholders::_1, std::placeholders::_2));
     methods.emplace("textDocument/completion",
         std::bind(&feature_language_features::completion, this, std::placeholders::_1, std::placeholders::_2));
+    methods.emplace("completionItem/resolve",
+        std::bind(&feature_language_features::completion_resolve, this, std::placeholders::_1, std::placeholders::_2));
+    methods.emplace("workspace/symbol",
+        std::bind(&feature_language_features::workspace_symbol, this, std::placeholders::_1, std::placeholders::_2));
+    methods.emplace("hlasm/memoryUsage",
+        std::bind(&feature_language_features::memory_usage, this, std::placeholders::_1, std::placeholders::_2));
 }
 
 json feature_language_features::register_capabilities()
 {
     return json { { "definitionProvider", true },
         { "referencesProvider", true },
+        { "workspaceSymbolProvider", true },
         { "hoverProvider", true },
         { "completionProvider",
-            { { "resolveProvider", false }, { "triggerCharacters", { "&", ".", "_", "$", "#", "@", "*" } } } } };
+            { { "resolveProvider", true }, { "triggerCharacters", { "&", ".", "_", "$", "#", "@", "*" } } } } };
 }
 
 void feature_language_features::initialize_feature(const json&) {}
@@ -109,15 +117,99 @@ void feature_language_features::completion(const json& id, const json& params)
     for (size_t i = 0; i < completion_list.count(); i++)
     {
         auto item = completion_list.item(i);
+        // the documentation is sent in the response to completionItem/resolve
         completion_item_array.push_back(json { { "label", item.label() },
             { "kind", item.kind() },
             { "detail", item.detail() },
-            { "documentation", item.documentation() },
             { "deprecated", item.deprecated() },
-            { "insertText", item.insert_text() } });
+            { "insertText", item.insert_text() },
+            { "data", { { "uri", document_uri }, { "kind", item.instruction() ? "instruction" : "symbol" } } } });
     }
     to_ret = json { { "isIncomplete", completion_list.is_incomplete() }, { "items", completion_item_array } };
 
     response_->respond(id, "", to_ret);
 }
+
+void feature_language_features::completion_resolve(const json& id, const json& params)
+{
+    // only instructions have documentation, the other items are complete already
+    if (params["data"].value("kind", "") != "instruction")
+    {
+        response_->respond(id, "", params);
+        return;
+    }
+
+    auto label = params["label"].get<std::string>();
+    auto document_uri = params["data"]["uri"].get<std::string>();
+
+    auto item = ws_mngr_.completion_resolve(uri_to_path(document_uri).c_str(), label.c_str());
+    json to_ret = params;
+    to_ret["documentation"] = item.documentation();
+    response_->respond(id, "", to_ret);
+}
+
+namespace {
+// kinds of the SymbolInformation of LSP
+int symbol_kind(parser_library::workspace_symbol_kind kind)
+{
+    switch (kind)
+    {
+        case parser_library::workspace_symbol_kind::macro:
+            return 12; // Function
+        case parser_library::workspace_symbol_kind::copy_member:
+            return 1; // File
+        case parser_library::workspace_symbol_kind::sequence:
+            return 20; // Key
+        default:
+            return 14; // Constant
+    }
+}
+} // namespace
+
+void feature_language_features::workspace_symbol(const json& id, const json& params)
+{
+    auto query = params["query"].get<std::string>();
+    json to_ret = json::array();
+    auto symbols = ws_mngr_.find_symbols(query.c_str());
+    for (size_t i = 0; i < symbols.size(); ++i)
+    {
+        auto symbol = symbols.item(i);
+        json location { { "uri", path_to_uri(symbol.document_uri) },
+            { "range", range_to_json(symbol.definition_range) } };
+        to_ret.push_back(
+            json { { "name", symbol.name }, { "kind", symbol_kind(symbol.kind) }, { "location", location } });
+    }
+    response_->respond(id, "", to_ret);
+}
+
+void feature_language_features::memory_usage(const json& id, const json& params)
+{
+    // the result can be limited to one document
+    std::string path;
+    auto document = params.find("textDocument");
+    if (document != params.end())
+        path = uri_to_path((*document)["uri"].get<std::string>());
+
+    std::vector<json> files;
+    auto usages = ws_mngr_.memory_usage();
+    for (size_t i = 0; i < usages.size(); ++i)
+    {
+        auto file = usages.item(i);
+        if (!path.empty() && path != file.document_uri)
+            continue;
+        files.push_back(json { { "uri", path_to_uri(file.document_uri) },
+            { "resident", file.resident },
+            { "context", file.usage.context },
+            { "lsp", file.usage.lsp },
+            { "highlighting", file.usage.highlighting },
+            { "tokens", file.usage.tokens },
+            { "cachedStatements", file.usage.cached_statements },
+            { "total", file.usage.total() } });
+    }
+    std::stable_sort(files.begin(), files.end(), [](const json& lhs, const json& rhs) {
+        return lhs["total"].get<size_t>() > rhs["total"].get<size_t>();
+    });
+
+    response_->respond(id, "", json(std::move(files)));
+}
 } // namespace hlasm_plugin::language_server::lsp
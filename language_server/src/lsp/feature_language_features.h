@@ -39,6 +39,12 @@ private:
     void references(const json& id, const json& params);
     void hover(const json& id, const json& params);
     void completion(const json& id, const json& params);
+    // fills in the documentation of a completion item selected by the user
+    void completion_resolve(const json& id, const json& params);
+    // symbols of the analyzed programs of the workspaces whose names start with the query
+    void workspace_symbol(const json& id, const json& params);
+    // custom request, returns estimated memory held by the analysis of each parsed file, largest first
+    void memory_usage(const json& id, const json& params);
 };
 
 } // namespace hlasm_plugin::language_server::lsp
@@ -42,6 +42,24 @@ json feature_workspace_folders::register_capabilities()
 
 void feature_workspace_folders::initialize_feature(const json& initialize_params)
 {
+    auto options = initialize_params.find("initializationOptions");
+    if (options != initialize_params.end() && options->is_object())
+    {
+        // memory budget is configured in megabytes
+        auto budget = options->find("memoryBudget");
+        if (budget != options->end() && budget->is_number_unsigned())
+            ws_mngr_.set_memory_budget(budget->get<size_t>() * 1024 * 1024);
+
+        auto threads = options->find("checkingThreads");
+        if (threads != options->end() && threads->is_number_unsigned())
+            ws_mngr_.set_checking_threads(threads->get<size_t>());
+
+        // directory of the editor for the state of the workspace
+        auto storage = options->find("storagePath");
+        if (storage != options->end() && storage->is_string())
+            ws_mngr_.set_storage_path(storage->get<std::string>().c_str());
+    }
+
     bool ws_folders_support = false;
     auto capabs = initialize_params["capabilities"];
     auto ws = capabs.find("workspace");
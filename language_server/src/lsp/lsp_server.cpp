@@ -19,6 +19,7 @@
 #include <map>
 
 #include "../logger.h"
+#include "../request_manager.h"
 #include "feature_language_features.h"
 #include "feature_text_synchronization.h"
 #include "feature_workspace_folders.h"
@@ -91,8 +92,12 @@ void server::register_methods()
         "initialize", std::bind(&server::on_initialize, this, std::placeholders::_1, std::placeholders::_2));
     methods_.emplace("shutdown", std::bind(&server::on_shutdown, this, std::placeholders::_1, std::placeholders::_2));
     methods_.emplace("exit", std::bind(&server::on_exit, this, std::placeholders::_1, std::placeholders::_2));
+    methods_.emplace("hlasm/queueWaitStats",
+        std::bind(&server::queue_wait_stats, this, std::placeholders::_1, std::placeholders::_2));
 }
 
+void server::set_request_manager(request_manager* req_mngr) { req_mngr_ = req_mngr; }
+
 void server::on_initialize(json id, const json& param)
 {
     // send server capabilities back
@@ -107,7 +112,6 @@ void server::on_initialize(json id, const json& param)
             { "documentHighlightProvider", false },
             { "renameProvider", false },
             { "documentSymbolProvider", false },
-            { "workspaceSymbolProvider", false },
             { "semanticHighlighting", true } } } };
 
     for (auto& f : features_)
@@ -125,6 +129,20 @@ void server::on_initialize(json id, const json& param)
     }
 }
 
+void server::queue_wait_stats(json id, const json&)
+{
+    json result = json::object();
+    if (req_mngr_)
+    {
+        auto stats = req_mngr_->wait_stats();
+        for (size_t i = 0; i < request_priority_count; ++i)
+            result[request_priority_names[i]] = json { { "count", stats[i].count },
+                { "totalMicroseconds", stats[i].total.count() },
+                { "maxMicroseconds", stats[i].max.count() } };
+    }
+    respond(id, "", result);
+}
+
 void server::on_shutdown(json id, const json&)
 {
     shutdown_request_received_ = true;
@@ -26,6 +26,10 @@
 #include "../server.h"
 #include "workspace_manager.h"
 
+namespace hlasm_plugin::language_server {
+class request_manager;
+} // namespace hlasm_plugin::language_server
+
 namespace hlasm_plugin::language_server::lsp {
 
 enum class message_type
@@ -48,6 +52,9 @@ public:
     // Parses LSP (JSON RPC) message and calls corresponding method.
     virtual void message_received(const json& message) override;
 
+    // Sets the request manager that executes the requests of the server, it provides the queue statistics.
+    void set_request_manager(request_manager* req_mngr);
+
 protected:
     // Sends respond to request to LSP client using send_message_provider.
     virtual void respond(const json& id, const std::string& requested_method, const json& args) override;
@@ -70,6 +77,8 @@ private:
     void on_initialize(json id, const json& param);
     // Implements the LSP shutdown request.
     void on_shutdown(json id, const json& param);
+    // Implements the hlasm/queueWaitStats request, responds with the queue wait times of the request manager.
+    void queue_wait_stats(json id, const json& param);
 
 
     // notifications
@@ -90,6 +99,8 @@ private:
     // Implements parser_library::diagnostics_consumer: wraps the diagnostics in json and
     // sends them to client.
     virtual void consume_diagnostics(parser_library::diagnostic_list diagnostics) override;
+
+    request_manager* req_mngr_ = nullptr;
 };
 
 } // namespace hlasm_plugin::language_server::lsp
@@ -65,7 +65,9 @@ int main(int argc, char** argv)
         SET_BINARY_MODE(stdout);
 
         hlasm_plugin::parser_library::workspace_manager ws_mngr(&cancel);
-        request_manager req_mngr(&cancel);
+        // libraries of workspaces are warmed up when there are no requests to handle
+        request_manager req_mngr(
+            &cancel, request_manager::default_debounce, [&ws_mngr]() { return ws_mngr.idle_work(); });
 
         dap::tcp_handler dap_handler(ws_mngr, req_mngr, (uint16_t)dap_port);
         dap_handler.async_accept();
@@ -74,6 +76,7 @@ int main(int argc, char** argv)
         newline_is_space::imbue_stream(cin);
 
         lsp::server server(ws_mngr);
+        server.set_request_manager(&req_mngr);
         int ret;
 
         if (argc > 3)
@@ -112,6 +115,14 @@ int main(int argc, char** argv)
         dap_thread.join();
         req_mngr.end_worker();
 
+#ifdef LOG_ON
+        auto stats = req_mngr.wait_stats();
+        for (size_t i = 0; i < request_priority_count; ++i)
+            LOG_INFO(std::string("Queue wait of ") + request_priority_names[i] + " work: "
+                + std::to_string(stats[i].count) + " times, total " + std::to_string(stats[i].total.count())
+                + " us, max " + std::to_string(stats[i].max.count()) + " us");
+#endif
+
         return ret;
     }
     catch (std::exception& ex)
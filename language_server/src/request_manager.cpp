@@ -14,17 +14,39 @@
 
 #include "request_manager.h"
 
+#include <algorithm>
+
 using namespace hlasm_plugin::language_server;
 
 request::request(json message, server* executing_server)
     : message(std::move(message))
     , valid(true)
     , executing_server(executing_server)
+    , received(std::chrono::steady_clock::now())
 {}
 
-request_manager::request_manager(std::atomic<bool>* cancel)
+void queue_wait_stats::add(std::chrono::steady_clock::duration wait)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(wait);
+    ++count;
+    total += us;
+    max = std::max(max, us);
+}
+
+namespace {
+bool is_did_change(const json& message)
+{
+    auto found = message.find("method");
+    return found != message.end() && *found == "textDocument/didChange";
+}
+} // namespace
+
+request_manager::request_manager(
+    std::atomic<bool>* cancel, std::chrono::milliseconds debounce, std::function<bool()> idle_work)
     : end_worker_(false)
     , cancel_(cancel)
+    , debounce_(debounce)
+    , idle_work_(std::move(idle_work))
     , worker_(&request_manager::handle_request_, this, &end_worker_)
 {}
 
@@ -36,6 +58,17 @@ void request_manager::add_request(server* server, json message)
         bool is_parsing_required = false;
         // get new file
         auto file = get_request_file_(message,&is_parsing_required);
+        // queries come from the document the user looks at
+        if (!file.empty() && message.find("id") != message.end())
+            active_file_ = file;
+        // the running step of the idle work gives way to any request
+        if (idle_work_running_ && cancel_)
+            *cancel_ = true;
+        // the analysis of another document gives way to the requests about the active document,
+        // the workspace finishes it in the background
+        if (currently_running_parsing_ && !file.empty() && file == active_file_ && currently_running_file_ != file
+            && cancel_)
+            *cancel_ = true;
         // if the new file is the same as the currently running one, cancel the old one
         if (currently_running_file_ == file && currently_running_file_ != "" && is_parsing_required) 
         {
@@ -48,8 +81,14 @@ void request_manager::add_request(server* server, json message)
             }
         }
 
-        // finally add it to the q
-        requests_.push_back(request(message, server));
+        // finally add it to the q, successive changes of a file are merged into a single request
+        if (!merge_did_change_(server, message))
+        {
+            requests_.push_back(request(message, server));
+            requests_.back().file = std::move(file);
+            if (is_did_change(message))
+                requests_.back().not_before = std::chrono::steady_clock::now() + debounce_;
+        }
     }
     // wake up the worker thread
     cond_.notify_one();
@@ -72,23 +111,88 @@ bool hlasm_plugin::language_server::request_manager::is_running()
     return result;
 }
 
+std::array<queue_wait_stats, request_priority_count> request_manager::wait_stats()
+{
+    std::lock_guard guard(stats_mtx_);
+    return wait_stats_;
+}
+
+size_t request_manager::next_request_() const
+{
+    if (active_file_.empty())
+        return 0;
+    for (size_t i = 0; i < requests_.size(); ++i)
+    {
+        const auto& file = requests_[i].file;
+        // requests that are not about a document keep their place
+        if (file.empty())
+            break;
+        if (file == active_file_)
+            return i;
+    }
+    return 0;
+}
+
 void request_manager::handle_request_(const std::atomic<bool>* end_loop)
 {
+    bool idle_work_pending = idle_work_ != nullptr;
+    // idle work that is put aside by requests waits in the queue too
+    bool idle_work_waiting = false;
+    std::chrono::steady_clock::time_point idle_work_since;
     // endless cycle in separate thread, pick up work if there is some, otherwise wait for work
     while (true)
     {
         std::unique_lock<std::mutex> lock(q_mtx_);
+        if (requests_.empty() && idle_work_pending && !*end_loop)
+        {
+            if (idle_work_waiting)
+            {
+                std::lock_guard guard(stats_mtx_);
+                wait_stats_[(size_t)request_priority::background].add(
+                    std::chrono::steady_clock::now() - idle_work_since);
+                idle_work_waiting = false;
+            }
+            if (cancel_)
+                *cancel_ = false;
+            idle_work_running_ = true;
+            lock.unlock();
+            idle_work_pending = idle_work_();
+            lock.lock();
+            idle_work_running_ = false;
+            lock.unlock();
+            finished_cond_.notify_all();
+            continue;
+        }
         // wait for work to come
         if (requests_.empty())
             cond_.wait(lock, [&] { return !requests_.empty() || *end_loop; });
         if (*end_loop) 
             return;
 
-        // get first request
-        auto to_run = std::move(requests_.front());
-        requests_.pop_front();
+        // a lone change waits for the debounce period, any other request flushes it immediately
+        if (requests_.size() == 1 && requests_.front().not_before > std::chrono::steady_clock::now())
+        {
+            cond_.wait_until(lock, requests_.front().not_before);
+            continue;
+        }
+
+        // get the request of the active document or the first one
+        auto next = requests_.begin() + next_request_();
+        auto to_run = std::move(*next);
+        requests_.erase(next);
+        auto priority = !to_run.file.empty() && to_run.file == active_file_ ? request_priority::active
+                                                                            : request_priority::open;
+        {
+            std::lock_guard guard(stats_mtx_);
+            wait_stats_[(size_t)priority].add(std::chrono::steady_clock::now() - to_run.received);
+        }
+        if (idle_work_pending && !idle_work_waiting)
+        {
+            idle_work_waiting = true;
+            idle_work_since = std::chrono::steady_clock::now();
+        }
         // remember file name that is about to be parsed
-        currently_running_file_ = get_request_file_(to_run.message);
+        currently_running_file_ = get_request_file_(to_run.message, &currently_running_parsing_);
         // if the request is valid, do not cancel
         // if not, cancel the parsing right away, only the file manager should update the data
         if (cancel_)
@@ -101,20 +205,25 @@ void request_manager::handle_request_(const std::atomic<bool>* end_loop)
         // handle the request
         to_run.executing_server->message_received(to_run.message);
 
+        lock.lock();
         currently_running_server_ = nullptr;
+        currently_running_parsing_ = false;
+        lock.unlock();
+        finished_cond_.notify_all();
+        idle_work_pending = idle_work_ != nullptr;
     }
 }
 
 void request_manager::finish_server_requests(server* to_finish)
 {
-    std::lock_guard guard(q_mtx_);
+    std::unique_lock lock(q_mtx_);
 
     if (cancel_)
         *cancel_ = true;
 
     // if currently running request runs on the server we are about to finish, wait for that request to finish.
-    while (currently_running_server_ == to_finish)
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // idle work uses the same workspaces as the requests
+    finished_cond_.wait(lock, [&] { return currently_running_server_ != to_finish && !idle_work_running_; });
 
     // executes all remaining requests for a server
     for (auto it = requests_.begin(); it != requests_.end(); ++it)
@@ -132,6 +241,28 @@ void request_manager::finish_server_requests(server* to_finish)
 }
 
 
+bool request_manager::merge_did_change_(server* server, const json& message)
+{
+    if (requests_.empty() || !is_did_change(message))
+        return false;
+
+    auto& last = requests_.back();
+    if (last.executing_server != server || !is_did_change(last.message)
+        || get_request_file_(last.message) != get_request_file_(message))
+        return false;
+
+    auto& last_params = last.message["params"];
+    const auto& params = message["params"];
+    for (const auto& change : params["contentChanges"])
+        last_params["contentChanges"].push_back(change);
+    last_params["textDocument"]["version"] = params["textDocument"]["version"];
+
+    // the merged request carries the newest text, so it must not be cancelled
+    last.valid = true;
+    last.not_before = std::chrono::steady_clock::now() + debounce_;
+    return true;
+}
+
 std::string request_manager::get_request_file_(json r, bool* is_parsing_required)
 {
     constexpr const char* didOpen = "textDocument/didOpen";
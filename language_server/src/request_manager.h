@@ -14,8 +14,11 @@
 
 #ifndef HLASMPLUGIN_LANGUAGESERVER_REQUEST_MANAGER_H
 #define HLASMPLUGIN_LANGUAGESERVER_REQUEST_MANAGER_H
+#include <array>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <mutex>
 #include <thread>
 
@@ -31,20 +34,65 @@ struct request
     json message;
     bool valid;
     server* executing_server;
+    // the request is not executed before this time unless other requests are waiting behind it
+    std::chrono::steady_clock::time_point not_before;
+    // document the request is about, empty for the requests that are not about a document
+    std::string file;
+    std::chrono::steady_clock::time_point received;
+};
+
+// Classes of work of the request manager, in the order in which they are executed.
+// The active document is the document of the latest query (a request that expects a response),
+// the editor sends queries for the documents the user looks at.
+enum class request_priority
+{
+    active, // requests about the active document
+    open, // requests about the other documents and requests that are not about a document
+    background, // idle work
+};
+
+constexpr size_t request_priority_count = 3;
+constexpr const char* request_priority_names[request_priority_count] = { "active", "open", "background" };
+
+// time the work of one class waited in the queue before it was started,
+// for the idle work it is the time it was put aside by requests
+struct queue_wait_stats
+{
+    size_t count = 0;
+    std::chrono::microseconds total = std::chrono::microseconds(0);
+    std::chrono::microseconds max = std::chrono::microseconds(0);
+
+    void add(std::chrono::steady_clock::duration wait);
 };
 
 // Holds and orders income messages(requests) from DAP and LSP.
 // The requests are held in a queue.
 // Runs a worker thread, that uses respectable server to execute
 // requests
+// Consecutive didChange notifications of a file are merged into one request,
+// which is executed after the debounce period passes without further changes
+// or as soon as any other request arrives.
+// When the queue is empty, the worker performs steps of the idle work one by one
+// until it reports there is nothing left, a new request is handled before the next step.
+// Requests about the active document overtake the other queued requests, except the requests
+// that are not about a document, which nothing overtakes. A new request preempts the running
+// step of the idle work using the cancellation token, a request about the active document
+// preempts the running analysis of another document too.
 class request_manager
 {
 public:
-    request_manager(std::atomic<bool>* cancel);
+    static constexpr std::chrono::milliseconds default_debounce = std::chrono::milliseconds(200);
+
+    request_manager(std::atomic<bool>* cancel,
+        std::chrono::milliseconds debounce = default_debounce,
+        std::function<bool()> idle_work = nullptr);
     void add_request(server* server, json message);
     void finish_server_requests(server* server);
     void end_worker();
     bool is_running();
+    // queue wait times indexed by request_priority, may be called by the requests themselves
+    std::array<queue_wait_stats, request_priority_count> wait_stats();
+
 private:
     std::atomic<bool> end_worker_;
 
@@ -52,21 +100,44 @@ private:
     // worker thread asleep when the request queue is empty
     std::mutex q_mtx_;
     std::condition_variable cond_;
+    // signals that the worker finished a request or a step of the idle work
+    std::condition_variable finished_cond_;
 
     // the request manager invalidates older requests on the
     // same file, when a new request to the same file comes
     std::string currently_running_file_;
     std::atomic<server*> currently_running_server_;
+    // the running request analyzes its file (didOpen or didChange)
+    bool currently_running_parsing_ = false;
 
     void handle_request_(const std::atomic<bool>* end_loop);
     std::string get_request_file_(json r, bool* is_parsing_required = nullptr);
+    // appends content changes of didChange message to the last queued request if it is a didChange of the same file
+    bool merge_did_change_(server* server, const json& message);
 
     std::deque<request> requests_;
 
+    // document of the latest query
+    std::string active_file_;
+    // returns the position of the next request to execute
+    size_t next_request_() const;
+
+    // the requests executed by finish_server_requests run under q_mtx_, so the stats have their own mutex
+    std::mutex stats_mtx_;
+    std::array<queue_wait_stats, request_priority_count> wait_stats_;
+
     // cancellation token that is used to stop current parsing
     // when it was obsoleted by a new request
     std::atomic<bool>* cancel_;
 
+    // quiet period after the last didChange of a file, before the file is parsed
+    std::chrono::milliseconds debounce_;
+
+    // performs one step of background work, returns false when there is nothing left to do
+    // it is tried again after each handled request, which may bring new work
+    std::function<bool()> idle_work_;
+    std::atomic<bool> idle_work_running_ = false;
+
     std::thread worker_;
 };
 
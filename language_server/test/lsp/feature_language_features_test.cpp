@@ -50,6 +50,33 @@ TEST(language_features, completion)
     notifs["textDocument/completion"]("", params1);
 }
 
+TEST(language_features, completion_resolve)
+{
+    using namespace ::testing;
+    ws_mngr_mock ws_mngr;
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(ws_mngr, response_mock);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+#ifdef _WIN32
+    json params1 = R"({"label":"LR","kind":1,"data":{"uri":"file:///c%3A/test","kind":"instruction"}})"_json;
+#else
+    json params1 = R"({"label":"LR","kind":1,"data":{"uri":"file:///home/test","kind":"instruction"}})"_json;
+#endif
+    context::completion_item_s item_s("LR", "machine", "LR", std::vector<std::string> { "machine doc" });
+    EXPECT_CALL(ws_mngr, completion_resolve(StrEq(path), StrEq("LR"))).WillOnce(Return(completion_item(item_s)));
+    json expected = params1;
+    expected["documentation"] = "machine doc\n";
+    EXPECT_CALL(response_mock, respond(json(""), "", expected));
+    notifs["completionItem/resolve"]("", params1);
+
+    // a symbol with the same name as an instruction gets no documentation
+    json params2 = params1;
+    params2["data"]["kind"] = "symbol";
+    EXPECT_CALL(response_mock, respond(json(""), "", params2));
+    notifs["completionItem/resolve"]("", params2);
+}
+
 TEST(language_features, hover)
 {
     using namespace ::testing;
@@ -107,4 +134,69 @@ TEST(language_features, references)
         .WillOnce(Return(position_uris(ret.data(), ret.size())));
     notifs["textDocument/references"]("", params1);
 }
+
+TEST(language_features, workspace_symbol)
+{
+    using namespace ::testing;
+    ws_mngr_mock ws_mngr;
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(ws_mngr, response_mock);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    std::vector<workspace_symbol> ret = { workspace_symbol(
+        "MAC", workspace_symbol_kind::macro, path, range(position(0, 1), position(0, 4))) };
+    EXPECT_CALL(ws_mngr, find_symbols(StrEq("MA"))).WillOnce(Return(workspace_symbols(ret.data(), ret.size())));
+    json expected = json::array({ { { "name", "MAC" },
+        { "kind", 12 },
+        { "location",
+            { { "uri", feature::path_to_uri(path) },
+                { "range",
+                    { { "start", { { "line", 0 }, { "character", 1 } } },
+                        { "end", { { "line", 0 }, { "character", 4 } } } } } } } } });
+    EXPECT_CALL(response_mock, respond(json(""), "", expected));
+    notifs["workspace/symbol"]("", R"({"query":"MA"})"_json);
+}
+
+TEST(language_features, memory_usage)
+{
+    using namespace ::testing;
+    ws_mngr_mock ws_mngr;
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(ws_mngr, response_mock);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    memory_usage small;
+    small.tokens = 10;
+    memory_usage large;
+    large.context = 100;
+    std::vector<file_memory_usage> ret = { file_memory_usage(path, true, small),
+        file_memory_usage("other", false, large) };
+    EXPECT_CALL(ws_mngr, memory_usage()).Times(2).WillRepeatedly(Return(file_memory_usages(ret.data(), ret.size())));
+
+    json small_json = { { "uri", feature::path_to_uri(path) },
+        { "resident", true },
+        { "context", 0 },
+        { "lsp", 0 },
+        { "highlighting", 0 },
+        { "tokens", 10 },
+        { "cachedStatements", 0 },
+        { "total", 10 } };
+    json large_json = { { "uri", feature::path_to_uri("other") },
+        { "resident", false },
+        { "context", 100 },
+        { "lsp", 0 },
+        { "highlighting", 0 },
+        { "tokens", 0 },
+        { "cachedStatements", 0 },
+        { "total", 100 } };
+
+    // the largest files go first
+    EXPECT_CALL(response_mock, respond(json(""), "", json::array({ large_json, small_json })));
+    notifs["hlasm/memoryUsage"]("", json::object());
+
+    EXPECT_CALL(response_mock, respond(json(""), "", json::array({ small_json })));
+    notifs["hlasm/memoryUsage"]("", json { { "textDocument", { { "uri", feature::path_to_uri(path) } } } });
+}
 #endif
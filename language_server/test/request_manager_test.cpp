@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "request_manager.h"
+
+using namespace hlasm_plugin;
+using namespace hlasm_plugin::language_server;
+
+namespace {
+
+// server that only records the messages it was asked to execute
+class recording_server : public server
+{
+public:
+    recording_server(parser_library::workspace_manager& ws_mngr)
+        : server(ws_mngr)
+    {}
+
+    void message_received(const json& message) override
+    {
+        std::lock_guard guard(mtx);
+        messages.push_back(message);
+    }
+
+    void respond(const json&, const std::string&, const json&) override {}
+    void notify(const std::string&, const json&) override {}
+    void respond_error(const json&, const std::string&, int, const std::string&, const json&) override {}
+
+    std::vector<json> received()
+    {
+        std::lock_guard guard(mtx);
+        return messages;
+    }
+
+private:
+    std::mutex mtx;
+    std::vector<json> messages;
+};
+
+// server that keeps the worker in its first message until it is released
+class blocking_server : public recording_server
+{
+public:
+    using recording_server::recording_server;
+
+    void message_received(const json& message) override
+    {
+        recording_server::message_received(message);
+        std::unique_lock lock(gate_mtx);
+        gate.wait(lock, [this] { return released; });
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard guard(gate_mtx);
+            released = true;
+        }
+        gate.notify_all();
+    }
+
+private:
+    std::mutex gate_mtx;
+    std::condition_variable gate;
+    bool released = false;
+};
+
+json make_did_change(const std::string& uri, int version, const std::string& text)
+{
+    return json { { "jsonrpc", "2.0" },
+        { "method", "textDocument/didChange" },
+        { "params",
+            { { "textDocument", { { "uri", uri }, { "version", version } } },
+                { "contentChanges",
+                    json::array({ { { "range",
+                                        { { "start", { { "line", 0 }, { "character", version } } },
+                                            { "end", { { "line", 0 }, { "character", version } } } } },
+                        { "text", text } } }) } } } };
+}
+
+json make_hover(const std::string& uri)
+{
+    return json { { "jsonrpc", "2.0" },
+        { "id", 1 },
+        { "method", "textDocument/hover" },
+        { "params",
+            { { "textDocument", { { "uri", uri } } }, { "position", { { "line", 0 }, { "character", 0 } } } } } };
+}
+
+// polls the condition set by the worker thread, gives up after a while so a broken worker fails the test
+bool wait_until(const std::function<bool()>& condition)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+// server whose analysis of a changed document runs until it is cancelled
+class cancellable_server : public recording_server
+{
+public:
+    cancellable_server(parser_library::workspace_manager& ws_mngr, const std::atomic<bool>& cancel)
+        : recording_server(ws_mngr)
+        , cancel(cancel)
+    {}
+
+    void message_received(const json& message) override
+    {
+        recording_server::message_received(message);
+        if (message["method"] == "textDocument/didChange")
+            preempted = wait_until([this] { return cancel.load(); });
+    }
+
+    std::atomic<bool> preempted = false;
+
+private:
+    const std::atomic<bool>& cancel;
+};
+
+void wait_for_requests(request_manager& req_mngr)
+{
+    while (req_mngr.is_running())
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+} // namespace
+
+TEST(request_manager, did_change_coalescing)
+{
+    std::atomic<bool> cancel = false;
+    parser_library::workspace_manager ws_mngr;
+    recording_server s(ws_mngr);
+    // the debounce period never passes, the changes of a are flushed by the change of b
+    request_manager req_mngr(&cancel, std::chrono::hours(1));
+
+    for (int i = 1; i <= 10; ++i)
+        req_mngr.add_request(&s, make_did_change("file:///a", i, std::to_string(i)));
+    req_mngr.add_request(&s, make_did_change("file:///b", 1, "b"));
+    // the merged change is not cancelled
+    EXPECT_FALSE(cancel);
+
+    // the lone change of b would wait for the debounce period
+    req_mngr.finish_server_requests(&s);
+    req_mngr.end_worker();
+
+    auto messages = s.received();
+    ASSERT_EQ(messages.size(), (size_t)2);
+
+    const auto& merged = messages[0]["params"];
+    EXPECT_EQ(merged["textDocument"]["uri"], "file:///a");
+    EXPECT_EQ(merged["textDocument"]["version"], 10);
+    ASSERT_EQ(merged["contentChanges"].size(), (size_t)10);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(merged["contentChanges"][i]["text"], std::to_string(i + 1));
+
+    EXPECT_EQ(messages[1]["params"]["textDocument"]["uri"], "file:///b");
+}
+
+TEST(request_manager, query_flushes_debounced_change)
+{
+    std::atomic<bool> cancel = false;
+    parser_library::workspace_manager ws_mngr;
+    recording_server s(ws_mngr);
+    // debounce period longer than the test is allowed to take
+    request_manager req_mngr(&cancel, std::chrono::hours(1));
+
+    req_mngr.add_request(&s, make_did_change("file:///a", 1, "x"));
+    req_mngr.add_request(&s, make_did_change("file:///a", 2, "y"));
+    req_mngr.add_request(&s, make_hover("file:///a"));
+
+    wait_for_requests(req_mngr);
+    req_mngr.end_worker();
+
+    auto messages = s.received();
+    ASSERT_EQ(messages.size(), (size_t)2);
+    EXPECT_EQ(messages[0]["params"]["contentChanges"].size(), (size_t)2);
+    EXPECT_EQ(messages[1]["method"], "textDocument/hover");
+}
+
+TEST(request_manager, idle_work_between_requests)
+{
+    std::atomic<bool> cancel = false;
+    parser_library::workspace_manager ws_mngr;
+    recording_server s(ws_mngr);
+
+    std::mutex mtx;
+    std::condition_variable idle_done;
+    std::vector<size_t> idle_steps;
+    size_t remaining = 3;
+    request_manager req_mngr(&cancel, std::chrono::milliseconds(0), [&]() {
+        std::lock_guard guard(mtx);
+        idle_steps.push_back(s.received().size());
+        if (--remaining > 0)
+            return true;
+        idle_done.notify_all();
+        return false;
+    });
+    auto wait_for_idle_work = [&]() {
+        std::unique_lock lock(mtx);
+        return idle_done.wait_for(lock, std::chrono::seconds(10), [&] { return remaining == 0; });
+    };
+
+    // the idle work runs until it reports there is nothing left
+    if (!wait_for_idle_work())
+    {
+        req_mngr.end_worker();
+        FAIL() << "idle work did not finish";
+    }
+
+    // a handled request may bring new idle work, so it is tried again
+    {
+        std::lock_guard guard(mtx);
+        remaining = 1;
+    }
+    req_mngr.add_request(&s, make_hover("file:///a"));
+    wait_for_requests(req_mngr);
+    if (!wait_for_idle_work())
+    {
+        req_mngr.end_worker();
+        FAIL() << "idle work did not resume after the request";
+    }
+    req_mngr.end_worker();
+
+    EXPECT_EQ(idle_steps, (std::vector<size_t> { 0, 0, 0, 1 }));
+}
+
+TEST(request_manager, active_document_first)
+{
+    std::atomic<bool> cancel = false;
+    parser_library::workspace_manager ws_mngr;
+    blocking_server s(ws_mngr);
+    request_manager req_mngr(&cancel, std::chrono::milliseconds(0));
+
+    req_mngr.add_request(&s, make_did_change("file:///x", 1, "x"));
+    while (s.received().empty())
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // the hover makes file:///a the active document
+    req_mngr.add_request(&s, make_did_change("file:///b", 1, "b"));
+    req_mngr.add_request(&s, make_did_change("file:///c", 1, "c"));
+    req_mngr.add_request(&s, make_hover("file:///a"));
+    req_mngr.add_request(&s, json { { "jsonrpc", "2.0" }, { "method", "workspace/didChangeConfiguration" } });
+    req_mngr.add_request(&s, make_hover("file:///a"));
+    s.release();
+
+    wait_for_requests(req_mngr);
+    req_mngr.end_worker();
+
+    auto messages = s.received();
+    ASSERT_EQ(messages.size(), (size_t)6);
+    // nothing overtakes the request that is not about a document
+    EXPECT_EQ(messages[1]["method"], "textDocument/hover");
+    EXPECT_EQ(messages[2]["params"]["textDocument"]["uri"], "file:///b");
+    EXPECT_EQ(messages[3]["params"]["textDocument"]["uri"], "file:///c");
+    EXPECT_EQ(messages[4]["method"], "workspace/didChangeConfiguration");
+    EXPECT_EQ(messages[5]["method"], "textDocument/hover");
+
+    auto stats = req_mngr.wait_stats();
+    EXPECT_EQ(stats[(size_t)request_priority::active].count, (size_t)2);
+    EXPECT_EQ(stats[(size_t)request_priority::open].count, (size_t)4);
+}
+
+TEST(request_manager, request_preempts_idle_work)
+{
+    std::atomic<bool> cancel = false;
+    parser_library::workspace_manager ws_mngr;
+    recording_server s(ws_mngr);
+
+    std::atomic<bool> idle_started = false;
+    std::atomic<bool> preempted = false;
+    std::atomic<size_t> calls = 0;
+    request_manager req_mngr(&cancel, std::chrono::milliseconds(0), [&]() {
+        if (calls++ > 0)
+            return false;
+        // long background analysis that checks the cancellation token
+        idle_started = true;
+        while (!cancel)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        preempted = true;
+        return true;
+    });
+
+    if (!wait_until([&] { return idle_started.load(); }))
+    {
+        cancel = true;
+        req_mngr.end_worker();
+        FAIL() << "idle work did not start";
+    }
+    req_mngr.add_request(&s, make_hover("file:///a"));
+    // the preempted work is continued after the request
+    if (!wait_until([&] { return calls >= 2; }))
+    {
+        cancel = true;
+        req_mngr.end_worker();
+        FAIL() << "preempted idle work was not continued";
+    }
+    req_mngr.end_worker();
+
+    EXPECT_TRUE(preempted);
+    EXPECT_EQ(s.received().size(), (size_t)1);
+    EXPECT_FALSE(cancel);
+
+    auto stats = req_mngr.wait_stats();
+    EXPECT_EQ(stats[(size_t)request_priority::background].count, (size_t)1);
+}
+
+TEST(request_manager, active_document_preempts_analysis)
+{
+    std::atomic<bool> cancel = false;
+    parser_library::workspace_manager ws_mngr;
+    cancellable_server s(ws_mngr, cancel);
+    request_manager req_mngr(&cancel, std::chrono::milliseconds(0));
+
+    req_mngr.add_request(&s, make_did_change("file:///x", 1, "x"));
+    while (s.received().empty())
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // the analysis of file:///x gives way to the query about file:///a
+    req_mngr.add_request(&s, make_hover("file:///a"));
+    wait_for_requests(req_mngr);
+    req_mngr.end_worker();
+
+    EXPECT_TRUE(s.preempted);
+    auto messages = s.received();
+    ASSERT_EQ(messages.size(), (size_t)2);
+    EXPECT_EQ(messages[1]["method"], "textDocument/hover");
+}
@@ -20,6 +20,7 @@ using namespace hlasm_plugin::language_server;
 
 class response_provider_mock : public response_provider
 {
+public:
     MOCK_METHOD3(respond, void(const json& id, const std::string& requested_method, const json& args));
     MOCK_METHOD2(notify, void(const std::string& method, const json& args));
     MOCK_METHOD5(respond_error,
@@ -24,6 +24,7 @@
 #include "lsp/feature_text_synchronization.h"
 #include "lsp/feature_workspace_folders.h"
 #include "lsp/lsp_server.h"
+#include "request_manager.h"
 #include "send_message_provider_mock.h"
 #include "workspace_manager.h"
 #include "ws_mngr_mock.h"
@@ -63,7 +64,36 @@ TEST(lsp_server_test, initialize)
     ASSERT_NE(server_capab.find("id"), server_capab.end());
     EXPECT_EQ(server_capab["id"].get<json::number_unsigned_t>(), 47);
     ASSERT_NE(server_capab.find("result"), server_capab.end());
-    EXPECT_NE(server_capab["result"].find("capabilities"), server_capab["result"].end());
+    ASSERT_NE(server_capab["result"].find("capabilities"), server_capab["result"].end());
+    // capabilities of the features are not overridden by the defaults of the server
+    EXPECT_EQ(server_capab["result"]["capabilities"]["workspaceSymbolProvider"], true);
+}
+
+TEST(lsp_server_test, queue_wait_stats)
+{
+    std::atomic<bool> cancel = false;
+    ws_mngr_mock ws_mngr;
+    send_message_provider_mock smpm;
+    request_manager req_mngr(&cancel);
+    lsp::server s(ws_mngr);
+    s.set_send_message_provider(&smpm);
+    s.set_request_manager(&req_mngr);
+
+    json reply;
+    EXPECT_CALL(smpm, reply(::testing::_)).WillOnce(::testing::SaveArg<0>(&reply));
+    s.message_received(R"({"jsonrpc":"2.0","id":48,"method":"hlasm/queueWaitStats","params":{}})"_json);
+    req_mngr.end_worker();
+
+    EXPECT_EQ(reply["id"].get<json::number_unsigned_t>(), 48);
+    ASSERT_NE(reply.find("result"), reply.end());
+    auto& result = reply["result"];
+    for (auto name : request_priority_names)
+    {
+        ASSERT_NE(result.find(name), result.end());
+        EXPECT_EQ(result[name]["count"].get<size_t>(), (size_t)0);
+        EXPECT_EQ(result[name]["totalMicroseconds"].get<long long>(), 0);
+        EXPECT_EQ(result[name]["maxMicroseconds"].get<long long>(), 0);
+    }
 }
 
 #endif // !HLASMPLUGIN_LANGUAGESERVER_TEST_SERVER_TEST_H
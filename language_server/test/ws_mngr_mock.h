@@ -42,6 +42,9 @@ public:
         completion,
         (const char* document_uri, const position pos, const char trigger_char, int trigger_kind),
         (override));
+    MOCK_METHOD(completion_item, completion_resolve, (const char* document_uri, const char* label), (override));
+    MOCK_METHOD(workspace_symbols, find_symbols, (const char* query), (override));
+    MOCK_METHOD(file_memory_usages, memory_usage, (), (override));
 };
 
 #endif // !HLASMPLUGIN_LANGUAGESERVER_TEST_WS_MNGR_MOCK_H
@@ -95,6 +95,7 @@ struct PARSER_LIBRARY_EXPORT completion_item
     const char* documentation();
     bool deprecated();
     const char* insert_text();
+    bool instruction();
 
 private:
     context::completion_item_s& impl_;
@@ -231,12 +232,124 @@ struct PARSER_LIBRARY_EXPORT performance_metrics
     size_t continued_statements = 0;
     size_t non_continued_statements = 0;
     size_t files = 0;
+    // operand fields parsed by the fast SLL prediction and operand fields that had to be parsed again with full LL
+    size_t sll_statements = 0;
+    size_t ll_fallback_statements = 0;
+    // largest number of open code tokens buffered at once and tokens kept alive after their statement was processed
+    size_t token_buffer_peak = 0;
+    size_t retained_tokens = 0;
+    // estimated memory held by analyzers of all files when the metrics were reported
+    size_t resident_memory = 0;
+    // time spent in phases of the analysis in nanoseconds, time of a phase does not include phases nested in it
+    // (e.g. parsing time does not include lexing of the parsed tokens nor processing of the parsed statement)
+    size_t lexing_time = 0;
+    size_t parsing_time = 0;
+    size_t reparsing_time = 0;
+    size_t processing_time = 0;
+    size_t ca_evaluation_time = 0;
+    size_t library_time = 0;
+    size_t lookahead_time = 0;
+    size_t postponed_checking_time = 0;
+    size_t lsp_processing_time = 0;
+    // number of members looked up in libraries, started lookaheads and checked postponed statements
+    size_t library_lookups = 0;
+    size_t lookaheads = 0;
+    size_t postponed_statements = 0;
+    // identifiers stored permanently, largest number of identifiers held at once including the scratch identifiers of
+    // generated names and estimated memory held by the identifiers
+    size_t identifiers = 0;
+    size_t identifiers_peak = 0;
+    size_t identifier_memory = 0;
+};
+
+// Estimated memory held by the analysis of a file in bytes, broken down by the structures that hold it.
+// The context of a program is shared with the macros and copy members it invokes, its tables are charged to the program
+// and the cached statements of a definition are charged to the file that contains the definition.
+struct PARSER_LIBRARY_EXPORT memory_usage
+{
+    // identifiers, ordinary symbols, sections, variable symbols and macro parameters of the hlasm context
+    size_t context = 0;
+    // symbol definitions and occurences of the lsp context, the text kept for hover and completion
+    size_t lsp = 0;
+    // semantic highlighting tokens and continuation positions
+    size_t highlighting = 0;
+    // source text held by the lexer and tokens buffered or retained by the token stream
+    size_t tokens = 0;
+    // statements of macro and copy member definitions kept in all their parsed forms
+    size_t cached_statements = 0;
+
+    size_t total() const { return context + lsp + highlighting + tokens + cached_statements; }
+
+    memory_usage& operator+=(const memory_usage& other)
+    {
+        context += other.context;
+        lsp += other.lsp;
+        highlighting += other.highlighting;
+        tokens += other.tokens;
+        cached_statements += other.cached_statements;
+        return *this;
+    }
+};
+
+// Memory usage of one parsed file
+struct PARSER_LIBRARY_EXPORT file_memory_usage
+{
+    file_memory_usage(const char* document_uri, bool resident, memory_usage usage)
+        : document_uri(document_uri)
+        , resident(resident)
+        , usage(usage)
+    {}
+
+    const char* document_uri;
+    // false when the analyzer state of the file was evicted, it holds no memory then
+    bool resident;
+    memory_usage usage;
+};
+
+template class PARSER_LIBRARY_EXPORT c_view_array<file_memory_usage, file_memory_usage>;
+using file_memory_usages = c_view_array<file_memory_usage, file_memory_usage>;
+
+enum class PARSER_LIBRARY_EXPORT workspace_symbol_kind
+{
+    macro,
+    copy_member,
+    ordinary,
+    sequence
+};
+
+// Symbol of the workspace symbol index with the location of its definition
+struct PARSER_LIBRARY_EXPORT workspace_symbol
+{
+    workspace_symbol(const char* name, workspace_symbol_kind kind, const char* document_uri, range definition_range)
+        : name(name)
+        , kind(kind)
+        , document_uri(document_uri)
+        , definition_range(definition_range)
+    {}
+
+    const char* name;
+    workspace_symbol_kind kind;
+    const char* document_uri;
+    range definition_range;
+};
+
+template class PARSER_LIBRARY_EXPORT c_view_array<workspace_symbol, workspace_symbol>;
+using workspace_symbols = c_view_array<workspace_symbol, workspace_symbol>;
+
+// Contiguous part of a diagnostic list, offset is the index of its first diagnostic in the whole list
+struct diagnostic_list_segment
+{
+    diagnostic_s* begin;
+    size_t size;
+    size_t offset;
 };
 
 struct PARSER_LIBRARY_EXPORT diagnostic_list
 {
     diagnostic_list();
     diagnostic_list(diagnostic_s* begin, size_t size);
+    // list spanning multiple segments, segments must be ordered by offset
+    diagnostic_list(const diagnostic_list_segment* segments, size_t segments_size, size_t size);
 
     diagnostic diagnostics(size_t index);
     size_t diagnostics_size();
@@ -244,6 +357,10 @@ struct PARSER_LIBRARY_EXPORT diagnostic_list
 private:
     diagnostic_s* begin_;
     size_t size_;
+    const diagnostic_list_segment* segments_;
+    size_t segments_size_;
+    // segment of the last accessed diagnostic, speeds up sequential access
+    size_t last_segment_;
 };
 
 struct PARSER_LIBRARY_EXPORT token_info
@@ -345,6 +462,10 @@ struct PARSER_LIBRARY_EXPORT variable
     set_type type() const;
     const char* value() const;
     var_reference_t variable_reference() const;
+    // number of children that are array elements, they can be requested in pages
+    size_t indexed_variables() const;
+    // number of children that are named fields
+    size_t named_variables() const;
 
 private:
     const debugging::variable& impl_;
@@ -104,11 +104,38 @@ public:
     virtual void did_close_file(const char* document_uri);
     virtual void did_change_watched_files(const char** paths, size_t size);
 
+    // Limits memory held by parsed files that are not open in the editor, 0 means unlimited.
+    // Least recently used files are evicted first, their state is rebuilt when needed again.
+    virtual void set_memory_budget(size_t bytes);
+    // Sets the number of threads checking postponed statements at the end of each analysis, 1 checks them sequentially.
+    // The setting applies to the workspaces of this manager from the next analysis of each program.
+    virtual void set_checking_threads(size_t threads);
+    // Sets the directory where the workspaces keep state between sessions, e.g. the usage of library members that
+    // the warm-up reads ahead. Nothing is kept when no directory is set.
+    virtual void set_storage_path(const char* path);
+
     virtual position_uri definition(const char* document_uri, const position pos);
     virtual position_uris references(const char* document_uri, const position pos);
     virtual const string_array hover(const char* document_uri, const position pos);
     virtual completion_list completion(
         const char* document_uri, const position pos, const char trigger_char, int trigger_kind);
+    // Returns the instruction completion item with the label including its documentation, which the completion list
+    // omits. Other completion items have no documentation.
+    virtual completion_item completion_resolve(const char* document_uri, const char* label);
+
+    // Returns symbols of the programs analyzed in the workspaces whose names start with the query.
+    // Programs stay indexed when they are closed. The result is limited, the client asks again as the user types.
+    virtual workspace_symbols find_symbols(const char* query);
+
+    // Returns estimated memory held by the analysis of each parsed file, including macros and copy members.
+    virtual file_memory_usages memory_usage();
+
+    // Performs one small step of background work, e.g. the analysis of dependants of a changed file that are not open
+    // in the editor, the warm-up of libraries of the added workspaces or the indexing of their programs that were not
+    // opened yet. The steps stop when the cancellation token is set and the stopped step is repeated later.
+    // Returns false when there is nothing left to do. The steps are short, so the caller can stop calling
+    // whenever a request arrives, but it must not call it concurrently with the other methods.
+    virtual bool idle_work();
 
     // implementation of observer pattern - register consumer. Unregistering not implemented (yet).
     virtual void register_highlighting_consumer(highlighting_consumer* consumer);
@@ -128,7 +155,8 @@ public:
 
     virtual stack_frames get_stack_frames();
     virtual scopes get_scopes(frame_id_t frame_id);
-    virtual variables get_variables(var_reference_t var_reference);
+    // Returns count variables starting with the variable at index start, count 0 returns all of them.
+    virtual variables get_variables(var_reference_t var_reference, size_t start, size_t count);
 
     virtual void set_breakpoints(const char* source_path, breakpoint* breakpoints, size_t br_size);
 
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+
+// benchmark of relocatable address arithmetic in a large DSECT layout
+// field lengths are defined at the end of the module, so every following address contains unresolved spaces
+// each block of fields is overlaid by ORG statements that refer back to the fields
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+std::string make_dsect_layout(int64_t blocks)
+{
+    const int fields = 8;
+    std::string source = "LAYOUT   DSECT\n";
+    for (int64_t b = 0; b < blocks; ++b)
+    {
+        auto block = "B" + std::to_string(b);
+        for (int f = 0; f < fields; ++f)
+        {
+            auto field = block + "F" + std::to_string(f);
+            source.append(field).append(" DS XL(").append(field).append("L)\n");
+        }
+        source.append(block).append("E EQU *\n");
+        source.append(" ORG ").append(block).append("F0\n");
+        source.append(block).append("O1 DS A\n");
+        source.append(" ORG ").append(block).append("F0+").append(std::to_string(fields)).append("\n");
+        source.append(block).append("O2 DS H\n");
+        source.append(" ORG ").append(block).append("E\n");
+        source.append(block).append("D EQU ").append(block).append("E-").append(block).append("F0\n");
+    }
+    for (int64_t b = 0; b < blocks; ++b)
+        for (int f = 0; f < fields; ++f)
+            source.append("B")
+                .append(std::to_string(b))
+                .append("F")
+                .append(std::to_string(f))
+                .append("L EQU ")
+                .append(std::to_string(f + 1))
+                .append("\n");
+    return source;
+}
+
+void dsect_org_layout(benchmark::State& state)
+{
+    auto source = make_dsect_layout(state.range(0));
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        a.analyze();
+        benchmark::DoNotOptimize(a.context().ord_ctx.get_symbol(a.context().ids().add("B0D")));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(dsect_org_layout)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+} // namespace
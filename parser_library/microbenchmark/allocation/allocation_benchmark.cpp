@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+#include "context/cached_statement.h"
+#include "context/lsp_context.h"
+#include "processing/statement.h"
+
+// benchmarks reporting heap allocations, they are built into their own executable
+// because the counting operator new replaces the global one for the whole program
+// macro_expansion: analysis of a program that expands a macro many times,
+// reports the number of heap allocations per executed macro statement
+// deferred_statement: expansions of one deferred statement that resolves the same way each time,
+// reports the number of heap allocations per expansion with and without the reuse of the resolved statement
+// lsp_definitions: definition maps of the lsp context filled with ordinary symbols and instructions,
+// reports the heap bytes per definition with one occurrence
+
+namespace {
+std::atomic<size_t> allocation_count = 0;
+std::atomic<size_t> allocated_bytes = 0;
+} // namespace
+
+// the overhead is two relaxed increments per allocation
+void* operator new(std::size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (auto p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+// argument: number of macro calls
+void macro_expansion(benchmark::State& state)
+{
+    std::string source = R"(
+         MACRO
+&L       EXPAND &R,&V
+         LCLA  &I
+&I       SETA  &V
+         AIF   (&I GT 10).BIG
+&L       LA    &R,&I.(0,&R)
+         AGO   .END
+.BIG     ANOP
+&L       L     &R,=F'&I'
+.END     ANOP
+         ST    &R,SAVE+4*(&R-1)
+         MEND
+SAVE     DS    16F
+)";
+    for (int64_t i = 0; i < state.range(0); ++i)
+        source.append("L")
+            .append(std::to_string(i))
+            .append("       EXPAND ")
+            .append(std::to_string(i % 15 + 1))
+            .append(",")
+            .append(std::to_string(i % 20))
+            .append("\n");
+
+    size_t allocations = 0;
+    size_t statements = 0;
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        auto before = allocation_count.load(std::memory_order_relaxed);
+        a.analyze();
+        allocations += allocation_count.load(std::memory_order_relaxed) - before;
+        statements += a.get_metrics().macro_statements;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["allocations_per_statement"] = (double)allocations / (double)statements;
+}
+BENCHMARK(macro_expansion)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+// argument: 1 reuses the resolved statement stored in the cache like the statement providers,
+// 0 creates a new resolved statement for each expansion
+void deferred_statement(benchmark::State& state)
+{
+    const bool reuse = state.range(0) != 0;
+    const size_t expansions = 1000;
+
+    auto base = std::make_shared<semantics::statement_si_deferred>(
+        range(), semantics::label_si(range()), semantics::instruction_si(range()), "1,2", range());
+    auto reparsed = std::make_shared<semantics::statement_si_defer_done>(
+        base, semantics::operands_si(range(), {}), semantics::remarks_si(range(), {}));
+    processing::processing_format format(processing::processing_kind::ORDINARY, processing::processing_form::MACH);
+    static const std::string name = "LA";
+    processing::op_code opcode(&name, context::instruction_type::MACH);
+
+    size_t allocations = 0;
+    for (auto _ : state)
+    {
+        context::cached_statement_storage cache(base);
+        auto before = allocation_count.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < expansions; ++i)
+        {
+            if (auto resolved = reuse ? cache.get_resolved(format, opcode) : nullptr)
+            {
+                benchmark::DoNotOptimize(resolved);
+                continue;
+            }
+            auto stmt = std::make_shared<const processing::resolved_statement_impl>(reparsed, opcode, format);
+            if (reuse)
+                cache.insert_resolved(stmt);
+            benchmark::DoNotOptimize(stmt);
+        }
+        allocations += allocation_count.load(std::memory_order_relaxed) - before;
+    }
+    state.SetItemsProcessed(state.iterations() * expansions);
+    state.counters["allocations_per_statement"] = (double)allocations / (double)(state.iterations() * expansions);
+}
+BENCHMARK(deferred_statement)->Arg(0)->Arg(1);
+
+// heap bytes of the map, the buckets are allocated before the measurement
+template<typename T, typename Fill> size_t definitions_bytes(size_t count, Fill fill)
+{
+    context::definitions<T> defs;
+    defs.reserve(count);
+    auto before = allocated_bytes.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i)
+        fill(defs, i);
+    return allocated_bytes.load(std::memory_order_relaxed) - before + defs.bucket_count() * sizeof(void*);
+}
+
+// argument: number of ordinary symbols and of instructions
+void lsp_definitions(benchmark::State& state)
+{
+    const auto count = (size_t)state.range(0);
+    const std::string file = "PROGRAM";
+    std::vector<std::string> names;
+    for (size_t i = 0; i < count; ++i)
+        names.push_back("SYM" + std::to_string(i));
+
+    size_t ord_bytes = 0;
+    size_t instr_bytes = 0;
+    for (auto _ : state)
+    {
+        ord_bytes = definitions_bytes<context::ord_definition>(count, [&](auto& defs, size_t i) {
+            range r(position(i, 0), position(i, 8));
+            defs[context::ord_definition(&names[i], &file, r)].emplace_back(r, &file);
+        });
+        instr_bytes = definitions_bytes<context::instr_definition>(count, [&](auto& defs, size_t i) {
+            range r(position(i, 1), position(i, 5));
+            defs[context::instr_definition(&names[i], &file, r, i, 0)].emplace_back(r, &file);
+        });
+    }
+    state.counters["ord_bytes_per_definition"] = (double)ord_bytes / (double)count;
+    state.counters["instr_bytes_per_definition"] = (double)instr_bytes / (double)count;
+}
+BENCHMARK(lsp_definitions)->Arg(10000);
+
+} // namespace
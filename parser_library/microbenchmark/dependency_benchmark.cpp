@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+
+// benchmarks of resolution of ordinary symbols through symbol_dependency_tables,
+// measured together with the analysis of the statements that define the symbols
+// chain: each symbol depends on the next one, the last one is defined at the end
+// fan_in: all symbols depend on a single symbol defined at the end
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+std::string make_chain(int64_t count)
+{
+    std::string source;
+    for (int64_t i = 0; i < count; ++i)
+        source.append("S").append(std::to_string(i)).append(" EQU S").append(std::to_string(i + 1)).append("+1\n");
+    source.append("S").append(std::to_string(count)).append(" EQU 1\n");
+    return source;
+}
+
+std::string make_fan_in(int64_t count)
+{
+    std::string source;
+    for (int64_t i = 0; i < count; ++i)
+        source.append("S").append(std::to_string(i)).append(" EQU LAST+").append(std::to_string(i)).append("\n");
+    source.append("LAST EQU 1\n");
+    return source;
+}
+
+void resolve(benchmark::State& state, const std::string& source)
+{
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        a.analyze();
+        benchmark::DoNotOptimize(a.context().ord_ctx.get_symbol(a.context().ids().add("S0")));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void symbol_dependency_chain(benchmark::State& state) { resolve(state, make_chain(state.range(0))); }
+BENCHMARK(symbol_dependency_chain)->Arg(100)->Arg(1000);
+
+void symbol_dependency_fan_in(benchmark::State& state) { resolve(state, make_fan_in(state.range(0))); }
+BENCHMARK(symbol_dependency_fan_in)->Arg(100)->Arg(1000);
+
+} // namespace
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+#include "expressions/visitors/expression_evaluator.h"
+
+// benchmarks of conditional assembly expression evaluation
+// the expressions are parsed once, only their evaluation is measured
+// LOOP macro evaluates comparisons, logical operators and built-in functions in AIF and SETB statements
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+class empty_attribute_provider : public processing::attribute_provider
+{
+    const resolved_reference_storage& lookup_forward_attribute_references(forward_reference_storage) override
+    {
+        return resolved_symbols;
+    }
+};
+
+std::string make_expressions(int64_t count)
+{
+    std::string source;
+    for (int64_t i = 0; i < count; ++i)
+    {
+        auto n = std::to_string(i % 100 + 1);
+        switch (i % 3)
+        {
+            case 0:
+                source.append("(&VAR+").append(n).append(")*3-&VAR/2\n");
+                break;
+            case 1:
+                source.append("((&VAR*").append(n).append(")/(&VAR+1))-(").append(n).append("-&VAR)\n");
+                break;
+            default:
+                source.append("-&VAR+").append(n).append("*(&VAR-").append(n).append(")\n");
+                break;
+        }
+    }
+    return source;
+}
+
+void ca_expression_evaluation(benchmark::State& state)
+{
+    analyzer a(make_expressions(state.range(0)));
+    auto tree = a.parser().expr_test();
+
+    auto var = a.context().create_local_variable<context::A_t>(a.context().ids().add("VAR"), true);
+    var->access_set_symbol<context::A_t>()->set_value(11);
+
+    empty_attribute_provider attr_provider;
+    expressions::expression_evaluator evaluator(
+        expressions::evaluation_context { a.context(), attr_provider, workspaces::empty_parse_lib_provider::instance });
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluator.visit(tree));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ca_expression_evaluation)->Arg(100)->Arg(1000);
+
+std::string make_logical_expressions(int64_t count)
+{
+    std::string source;
+    for (int64_t i = 0; i < count; ++i)
+    {
+        auto n = std::to_string(i % 100 + 1);
+        switch (i % 3)
+        {
+            case 0:
+                source.append("(&VAR GT ").append(n).append(" AND NOT &VAR EQ ").append(n).append(")\n");
+                break;
+            case 1:
+                source.append("(UPPER('abc') EQ 'ABC' OR &VAR LT ").append(n).append(")\n");
+                break;
+            default:
+                source.append("(INDEX('HELLO','L') GT 0 XOR &VAR NE ").append(n).append(")\n");
+                break;
+        }
+    }
+    return source;
+}
+
+void ca_logical_expression_evaluation(benchmark::State& state)
+{
+    analyzer a(make_logical_expressions(state.range(0)));
+    auto tree = a.parser().expr_test();
+
+    auto var = a.context().create_local_variable<context::A_t>(a.context().ids().add("VAR"), true);
+    var->access_set_symbol<context::A_t>()->set_value(11);
+
+    empty_attribute_provider attr_provider;
+    expressions::expression_evaluator evaluator(
+        expressions::evaluation_context { a.context(), attr_provider, workspaces::empty_parse_lib_provider::instance });
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluator.visit(tree));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ca_logical_expression_evaluation)->Arg(100)->Arg(1000);
+
+const std::string loop_macro = R"(
+         MACRO
+         LOOP  &N
+         LCLA  &I,&HITS
+         LCLB  &B
+         ACTR  10000000
+&I       SETA  1
+.LOOP    AIF   (&I GT &N).END
+&B       SETB  (&I GE 10 AND NOT &I EQ 20 OR (&I SLL 1) LT 8)
+         AIF   (NOT &B).NEXT
+         AIF   ('&I' EQ '5' OR INDEX('&I','7') NE 0).NEXT
+&HITS    SETA  &HITS+1
+.NEXT    ANOP
+&I       SETA  &I+1
+         AGO   .LOOP
+.END     ANOP
+         MEND
+)";
+
+void aif_setb_loop(benchmark::State& state)
+{
+    auto source = loop_macro + "         LOOP  " + std::to_string(state.range(0)) + "\n";
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        a.analyze();
+        benchmark::DoNotOptimize(a.get_metrics().macro_statements);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(aif_setb_loop)->Arg(1000)->Arg(10000);
+
+} // namespace
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "workspaces/file_impl.h"
+
+// benchmarks of incremental changes of an open document
+// each iteration applies a change and reverts it, so the document does not grow
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+std::string make_document(int64_t lines)
+{
+    std::string text;
+    for (int64_t i = 0; i < lines; ++i)
+        text.append("LBL").append(std::to_string(i)).append("   LR    1,2 REMARK\n");
+    return text;
+}
+
+void file_keystroke(benchmark::State& state)
+{
+    workspaces::file_impl file("file");
+    file.did_open(make_document(state.range(0)), 1);
+    const size_t line = (size_t)state.range(0) / 2;
+    for (auto _ : state)
+    {
+        file.did_change(range(position(line, 10), position(line, 10)), "X");
+        file.did_change(range(position(line, 10), position(line, 11)), "");
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(file_keystroke)->Arg(1000)->Arg(100000);
+
+void file_new_line(benchmark::State& state)
+{
+    workspaces::file_impl file("file");
+    file.did_open(make_document(state.range(0)), 1);
+    const size_t line = (size_t)state.range(0) / 2;
+    for (auto _ : state)
+    {
+        file.did_change(range(position(line, 10), position(line, 10)), "\n");
+        file.did_change(range(position(line, 10), position(line + 1, 0)), "");
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(file_new_line)->Arg(1000)->Arg(100000);
+
+} // namespace
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "workspaces/file_manager_impl.h"
+
+// contention benchmarks of the file manager, all threads look up files of the same file manager
+// while the first thread optionally keeps editing one of the files
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+
+namespace {
+
+const size_t file_count = 1000;
+
+std::unique_ptr<file_manager_impl> shared_manager;
+std::vector<std::string> uris;
+
+void set_up_manager()
+{
+    shared_manager = std::make_unique<file_manager_impl>();
+    uris.clear();
+    for (size_t i = 0; i < file_count; ++i)
+    {
+        uris.push_back("file:///c%3A/bench/file" + std::to_string(i) + ".hlasm");
+        shared_manager->did_open_file(uris.back(), 1, " LR 1,1");
+        shared_manager->add_processor_file(uris.back());
+    }
+}
+
+// every thread looks up all files in a different order
+void file_manager_find(benchmark::State& state)
+{
+    if (state.thread_index == 0)
+        set_up_manager();
+
+    size_t i = (size_t)state.thread_index * 7919;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(shared_manager->find_processor_file(uris[i++ % file_count]));
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index == 0)
+        shared_manager.reset();
+}
+BENCHMARK(file_manager_find)->ThreadRange(1, 16)->UseRealTime();
+
+// the first thread edits a file, the other threads look up files
+void file_manager_find_while_editing(benchmark::State& state)
+{
+    if (state.thread_index == 0)
+        set_up_manager();
+
+    const document_change change({ { 0, 0 }, { 0, 0 } }, " ", 1);
+    size_t i = (size_t)state.thread_index * 7919;
+    for (auto _ : state)
+    {
+        if (state.thread_index == 0)
+            shared_manager->did_change_file(uris[i++ % file_count], 2, &change, 1);
+        else
+            benchmark::DoNotOptimize(shared_manager->find_processor_file(uris[i++ % file_count]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index == 0)
+        shared_manager.reset();
+}
+BENCHMARK(file_manager_find_while_editing)->ThreadRange(2, 16)->UseRealTime();
+
+} // namespace
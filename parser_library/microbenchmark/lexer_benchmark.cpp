@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "lexing/input_source.h"
+#include "lexing/lexer.h"
+
+// benchmark of lexer throughput on generated open code
+// the source mixes machine instructions, data definitions with strings,
+// conditional assembly statements and continued statements
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+std::string make_source(int64_t statements)
+{
+    std::string source;
+    for (int64_t i = 0; i < statements; ++i)
+    {
+        auto n = std::to_string(i);
+        switch (i % 4)
+        {
+            case 0:
+                source.append("LBL").append(n).append(" LR    1,2 REMARK\n");
+                break;
+            case 1:
+                source.append("         DC    C'TEXT").append(n).append("',F'").append(n).append("',A(LBL0+4)\n");
+                break;
+            case 2:
+                source.append("&VAR").append(n).append(" SETA  (&VAR0+").append(n).append(")*2\n");
+                break;
+            default: {
+                std::string line = "         LA    1,4(2,3),";
+                line.resize(71, ' ');
+                source.append(line).append("X\n               REMARK AFTER CONTINUATION\n");
+                break;
+            }
+        }
+    }
+    return source;
+}
+
+void lexer_throughput(benchmark::State& state)
+{
+    auto source = make_source(state.range(0));
+    size_t tokens = 0;
+    for (auto _ : state)
+    {
+        lexing::input_source input(source);
+        lexing::lexer l(&input, nullptr);
+        while (l.nextToken()->getType() != antlr4::Token::EOF)
+            ++tokens;
+    }
+    state.SetItemsProcessed(tokens);
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(lexer_throughput)->Arg(1000)->Arg(10000);
+
+} // namespace
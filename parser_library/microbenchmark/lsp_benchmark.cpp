@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+
+// benchmarks of lsp_info_processor queries on a generated source
+// each query is asked for every call of the macro in the source
+// the memory benchmark reports the memory held by the lsp context of a large program
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+const size_t first_call_line = 4;
+
+// each statement pair defines a variable and passes it to the macro
+// the operand of the macro call starts at column 15
+std::string make_source(int64_t calls)
+{
+    std::string source = R"(         MACRO
+&L       MAC   &P
+&L       LR    &P,&P
+         MEND
+)";
+    for (int64_t i = 0; i < calls; ++i)
+    {
+        auto n = std::to_string(i);
+        auto var = "&V" + n;
+        auto label = "L" + n;
+        source.append(var).append(std::string(9 - var.size(), ' ')).append("SETA  ").append(n).append("\n");
+        source.append(label).append(std::string(9 - label.size(), ' ')).append("MAC   ").append(var).append("\n");
+    }
+    return source;
+}
+
+position call_operand(size_t i) { return position(first_call_line + 2 * i + 1, 16); }
+
+class lsp_benchmark : public benchmark::Fixture
+{
+public:
+    void SetUp(const benchmark::State& state) override
+    {
+        calls = (size_t)state.range(0);
+        a = std::make_unique<analyzer>(make_source(state.range(0)), "source");
+        a->analyze();
+    }
+
+    void TearDown(const benchmark::State&) override { a.reset(); }
+
+protected:
+    std::unique_ptr<analyzer> a;
+    size_t calls = 0;
+};
+
+BENCHMARK_DEFINE_F(lsp_benchmark, go_to_definition)(benchmark::State& state)
+{
+    for (auto _ : state)
+        for (size_t i = 0; i < calls; ++i)
+            benchmark::DoNotOptimize(a->lsp_processor().go_to_definition(call_operand(i)));
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+BENCHMARK_REGISTER_F(lsp_benchmark, go_to_definition)->Arg(100)->Arg(1000);
+
+BENCHMARK_DEFINE_F(lsp_benchmark, references)(benchmark::State& state)
+{
+    for (auto _ : state)
+        for (size_t i = 0; i < calls; ++i)
+            benchmark::DoNotOptimize(a->lsp_processor().references(call_operand(i)));
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+BENCHMARK_REGISTER_F(lsp_benchmark, references)->Arg(100)->Arg(1000);
+
+BENCHMARK_DEFINE_F(lsp_benchmark, hover)(benchmark::State& state)
+{
+    for (auto _ : state)
+        for (size_t i = 0; i < calls; ++i)
+            benchmark::DoNotOptimize(a->lsp_processor().hover(position(first_call_line + 2 * i + 1, 10)));
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+BENCHMARK_REGISTER_F(lsp_benchmark, hover)->Arg(100)->Arg(1000);
+
+BENCHMARK_DEFINE_F(lsp_benchmark, completion)(benchmark::State& state)
+{
+    for (auto _ : state)
+        for (size_t i = 0; i < calls; ++i)
+            benchmark::DoNotOptimize(a->lsp_processor().completion(call_operand(i), '&', 2));
+    state.SetItemsProcessed(state.iterations() * calls);
+}
+BENCHMARK_REGISTER_F(lsp_benchmark, completion)->Arg(100)->Arg(1000);
+
+// each group of statements defines an ordinary symbol, a constant and uses both in a machine instruction
+std::string make_symbol_source(int64_t symbols)
+{
+    std::string source;
+    for (int64_t i = 0; i < symbols; ++i)
+    {
+        auto n = std::to_string(i);
+        source.append("E").append(n).append(" EQU ").append(n).append("\n");
+        source.append("D").append(n).append(" DC F'").append(n).append("'\n");
+        source.append(" LA 1,E").append(n).append("\n");
+        source.append(" L 1,D").append(n).append("\n");
+    }
+    return source;
+}
+
+void lsp_memory(benchmark::State& state)
+{
+    const auto source = make_symbol_source(state.range(0));
+    memory_usage usage;
+    for (auto _ : state)
+    {
+        analyzer a(source, "source");
+        a.analyze();
+        usage = a.get_memory_usage();
+    }
+    state.counters["lsp_bytes"] = (double)usage.lsp;
+    state.counters["lsp_bytes_per_symbol"] = (double)usage.lsp / (double)(2 * state.range(0));
+}
+BENCHMARK(lsp_memory)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+
+// benchmark of macro_definition::call, which binds actual parameters of a macro
+// instruction to the parameters of the macro definition
+// arguments: number of positional parameters, number of keyword parameters
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+// appends statement with operands continued to the following lines when they do not fit
+void append_statement(std::string& source, const std::string& name_fields, const std::vector<std::string>& operands)
+{
+    std::string line = name_fields;
+    for (size_t i = 0; i < operands.size(); ++i)
+    {
+        auto operand = operands[i] + (i + 1 < operands.size() ? "," : "");
+        if (line.size() + operand.size() > 71)
+        {
+            line.resize(71, ' ');
+            source.append(line).append("X\n");
+            line = std::string(15, ' ');
+        }
+        line.append(operand);
+    }
+    source.append(line).append("\n");
+}
+
+void macro_call(benchmark::State& state)
+{
+    const auto positional = (size_t)state.range(0);
+    const auto keyword = (size_t)state.range(1);
+
+    std::vector<std::string> params;
+    for (size_t i = 0; i < positional; ++i)
+        params.push_back("&P" + std::to_string(i));
+    for (size_t i = 0; i < keyword; ++i)
+        params.push_back("&K" + std::to_string(i) + "=DEFAULT");
+
+    std::string source = "         MACRO\n";
+    append_statement(source, "&L       MAC   ", params);
+    source.append("         MEND\n");
+
+    analyzer a(source);
+    a.analyze();
+
+    auto& ids = a.context().ids();
+    auto macro = a.context().macros().find(ids.add("MAC"))->second;
+    auto syslist = ids.add("SYSLIST");
+    std::vector<context::id_index> keywords;
+    for (size_t i = 0; i < keyword; ++i)
+        keywords.push_back(ids.add("K" + std::to_string(i)));
+
+    for (auto _ : state)
+    {
+        // the actual parameters are consumed by the call, so building them is part of the measurement
+        std::vector<context::macro_arg> args;
+        for (size_t i = 0; i < positional; ++i)
+            args.emplace_back(std::make_unique<context::macro_param_data_single>("VALUE"));
+        for (size_t i = 0; i < keyword; ++i)
+            args.emplace_back(std::make_unique<context::macro_param_data_single>("VALUE"), keywords[i]);
+
+        benchmark::DoNotOptimize(
+            macro->call(std::make_unique<context::macro_param_data_single>("LABEL"), std::move(args), syslist));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(macro_call)->Args({ 2, 2 })->Args({ 16, 16 });
+
+} // namespace
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+
+// benchmarks of reparsing operand fields, which happens for every statement
+// whose operands are not known at the time of the first parse (e.g. model statements
+// or operands of macro instructions and deferred statements)
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+std::string make_machine_operands(int64_t operands)
+{
+    std::string field;
+    for (int64_t i = 0; i < operands; ++i)
+    {
+        if (i)
+            field.append(",");
+        field.append(i % 2 ? "4(2,3)" : "LBL+X'1F'*(2-1)");
+    }
+    return field;
+}
+
+std::string make_macro_operands(int64_t operands)
+{
+    std::string field;
+    for (int64_t i = 0; i < operands; ++i)
+    {
+        if (i)
+            field.append(",");
+        field.append(i % 2 ? "(A,B,'STRING')" : "KEY" + std::to_string(i) + "=VALUE");
+    }
+    return field;
+}
+
+void reparse(benchmark::State& state, const std::string& field, processing::processing_form form)
+{
+    analyzer a(" LR &VAR,1");
+    range r(position(0, 4), position(0, 4 + field.size()));
+    processing::processing_status status(
+        processing::processing_format(processing::processing_kind::ORDINARY, form), processing::op_code());
+    for (auto _ : state)
+    {
+        auto result = a.parser().parse_operand_field(
+            &a.context(), field, false, semantics::range_provider(r, semantics::adjusting_state::NONE), status);
+        benchmark::DoNotOptimize(result.first.value.size());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * field.size());
+}
+
+void reparse_machine_operands(benchmark::State& state)
+{
+    reparse(state, make_machine_operands(state.range(0)), processing::processing_form::MACH);
+}
+BENCHMARK(reparse_machine_operands)->Arg(2)->Arg(16);
+
+void reparse_macro_operands(benchmark::State& state)
+{
+    reparse(state, make_macro_operands(state.range(0)), processing::processing_form::MAC);
+}
+BENCHMARK(reparse_macro_operands)->Arg(2)->Arg(16);
+
+} // namespace
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+
+// benchmark of checking of postponed statements at the end of the analysis
+// every machine and DC statement refers to symbols defined at the end of the program, so all of them are postponed
+// the measured time is the time of the checking phase only
+// argument: number of checking threads
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+std::string make_forward_references(size_t count)
+{
+    std::string source = R"(
+         MACRO
+&L       GEN   &R,&D
+&L       LA    &R,FIELD+&D
+         ST    &R,SAVE+4*&R
+         DC    A(FIELD+&D,SAVE)
+         MEND
+TEST     CSECT
+)";
+    for (size_t i = 0; i < count; ++i)
+        source.append("         GEN   ")
+            .append(std::to_string(i % 16))
+            .append(",")
+            .append(std::to_string(i % 4000))
+            .append("\n");
+    source.append(R"(
+SAVE     DS    16F
+FIELD    DS    XL4096
+)");
+    return source;
+}
+
+void postponed_checking(benchmark::State& state)
+{
+    const auto source = make_forward_references(20000);
+    analyzer_options options { (size_t)state.range(0) };
+
+    size_t statements = 0;
+    for (auto _ : state)
+    {
+        analyzer a(source, "", workspaces::empty_parse_lib_provider::instance, nullptr, false, options);
+        a.analyze();
+        const auto& metrics = a.get_metrics();
+        state.SetIterationTime((double)metrics.postponed_checking_time / 1e9);
+        statements += metrics.postponed_statements;
+    }
+    state.SetItemsProcessed(statements);
+}
+BENCHMARK(postponed_checking)->Arg(1)->Arg(2)->Arg(4)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+#include "context/variables/set_symbol.h"
+
+// benchmarks of subscripted SET symbol access
+// FILL macro assigns every element of a global SETA array in a loop,
+// SCAN macro reads every element of the array back and sums it
+// BUILD macro builds a long SETC value by appending in a loop and copies it into another symbol
+
+using namespace hlasm_plugin::parser_library;
+
+namespace {
+
+const std::string array_macros = R"(
+         MACRO
+         FILL  &N,&STEP
+         GBLA  &ARR(1)
+         LCLA  &I
+         ACTR  10000000
+&I       SETA  1
+.LOOP    AIF   (&I GT &N).END
+&ARR(&I*&STEP) SETA &I
+&I       SETA  &I+1
+         AGO   .LOOP
+.END     ANOP
+         MEND
+         MACRO
+         SCAN  &N,&STEP
+         GBLA  &ARR(1)
+         LCLA  &I,&SUM
+         ACTR  10000000
+&I       SETA  1
+.LOOP    AIF   (&I GT &N).END
+&SUM     SETA  &SUM+&ARR(&I*&STEP)
+&I       SETA  &I+1
+         AGO   .LOOP
+.END     ANOP
+         MEND
+)";
+
+std::string make_source(int64_t count, int64_t step, bool scan)
+{
+    std::string source = array_macros;
+    source.append("         FILL  ").append(std::to_string(count)).append(",").append(std::to_string(step)).append("\n");
+    if (scan)
+        source.append("         SCAN  ").append(std::to_string(count)).append(",").append(std::to_string(step)).append("\n");
+    return source;
+}
+
+void set_array_fill(benchmark::State& state)
+{
+    auto source = make_source(state.range(0), state.range(1), false);
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        a.analyze();
+        benchmark::DoNotOptimize(a.context().globals().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(set_array_fill)->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 10000, 1000 });
+
+void set_array_scan(benchmark::State& state)
+{
+    auto source = make_source(state.range(0), state.range(1), true);
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        a.analyze();
+        benchmark::DoNotOptimize(a.context().globals().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(set_array_scan)->Args({ 1000, 1 })->Args({ 10000, 1 })->Args({ 10000, 1000 });
+
+void set_symbol_direct_access(benchmark::State& state)
+{
+    context::set_symbol<context::A_t> arr(nullptr, false, true);
+    const auto count = (size_t)state.range(0);
+    const auto step = (size_t)state.range(1);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < count; ++i)
+            arr.set_value((context::A_t)i, i * step);
+        context::A_t sum = 0;
+        for (size_t i = 0; i < count; ++i)
+            sum += arr.get_value(i * step);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(set_symbol_direct_access)->Args({ 10000, 1 })->Args({ 10000, 1000 });
+
+const std::string string_macro = R"(
+         MACRO
+         BUILD &N
+         LCLC  &S,&T
+         LCLA  &I
+         ACTR  10000000
+&I       SETA  1
+.LOOP    AIF   (&I GT &N).END
+&S       SETC  '&S.X'
+&T       SETC  '&S'
+&I       SETA  &I+1
+         AGO   .LOOP
+.END     ANOP
+         MEND
+)";
+
+void setc_string_building(benchmark::State& state)
+{
+    auto source = string_macro + "         BUILD " + std::to_string(state.range(0)) + "\n";
+    for (auto _ : state)
+    {
+        analyzer a(source);
+        a.analyze();
+        benchmark::DoNotOptimize(a.context().globals().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(setc_string_building)->Arg(100)->Arg(1000)->Arg(4000);
+
+} // namespace
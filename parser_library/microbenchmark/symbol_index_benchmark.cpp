@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "analyzer.h"
+#include "workspaces/symbol_index.h"
+
+// benchmarks of the lookups in the workspace symbol index
+// the index holds programs with their own symbols, all programs use the symbols of a shared copy member
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+
+namespace {
+
+const size_t programs = 50;
+const size_t local_symbols = 1000;
+const size_t shared_symbols = 200;
+const std::string shared_member = "SHARED";
+
+// provides the copy member defining the shared symbols
+class shared_lib_provider : public parse_lib_provider
+{
+public:
+    shared_lib_provider()
+    {
+        for (size_t i = 0; i < shared_symbols; ++i)
+            source_.append("S").append(std::to_string(i)).append(" EQU ").append(std::to_string(i)).append("\n");
+    }
+
+    parse_result parse_library(const std::string&, context::hlasm_context& hlasm_ctx, const library_data data) override
+    {
+        analyzer a(source_, shared_member, hlasm_ctx, *this, data);
+        a.analyze();
+        return true;
+    }
+    bool has_library(const std::string&, context::hlasm_context&) const override { return true; }
+
+private:
+    std::string source_;
+};
+
+std::string program_name(size_t program) { return "PGM" + std::to_string(program); }
+
+std::string local_symbol(size_t program, size_t symbol)
+{
+    return "L" + std::to_string(program) + "_" + std::to_string(symbol);
+}
+
+// local symbol s is defined on line s + 1, each local symbol is used once and each shared symbol twice
+std::string make_program(size_t program)
+{
+    std::string source = " COPY " + shared_member + "\n";
+    for (size_t s = 0; s < local_symbols; ++s)
+        source.append(local_symbol(program, s)).append(" EQU ").append(std::to_string(s)).append("\n");
+    for (size_t s = 0; s < local_symbols; ++s)
+        source.append(" LA 1,").append(local_symbol(program, s)).append("\n");
+    for (size_t s = 0; s < 2 * shared_symbols; ++s)
+        source.append(" LA 1,S").append(std::to_string(s % shared_symbols)).append("\n");
+    return source;
+}
+
+const symbol_index& get_index()
+{
+    static const auto index = []() {
+        auto index = std::make_unique<symbol_index>();
+        shared_lib_provider lib_provider;
+        for (size_t p = 0; p < programs; ++p)
+        {
+            analyzer a(make_program(p), program_name(p), lib_provider);
+            a.analyze();
+            index->update(program_name(p), a.context());
+        }
+        return index;
+    }();
+    return *index;
+}
+
+void symbol_index_find_prefix(benchmark::State& state)
+{
+    const auto& index = get_index();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(index.find("L1", workspace_symbol_limit));
+    state.counters["symbols"] = (double)index.symbol_count();
+}
+BENCHMARK(symbol_index_find_prefix);
+
+void symbol_index_find_name(benchmark::State& state)
+{
+    const auto& index = get_index();
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(index.find(local_symbol(i++ % programs, 17), workspace_symbol_limit));
+}
+BENCHMARK(symbol_index_find_name);
+
+void symbol_index_defined_at(benchmark::State& state)
+{
+    const auto& index = get_index();
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(index.defined_at(shared_member, position(i++ % shared_symbols, 0)));
+}
+BENCHMARK(symbol_index_defined_at);
+
+// occurrences of a symbol used by a single program
+void symbol_index_local_occurrences(benchmark::State& state)
+{
+    const auto& index = get_index();
+    std::vector<const index_symbol*> symbols;
+    for (size_t p = 0; p < programs; ++p)
+        symbols.push_back(index.defined_at(program_name(p), position(18, 0)));
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(index.occurrences(*symbols[i++ % programs]));
+}
+BENCHMARK(symbol_index_local_occurrences);
+
+// occurrences of a symbol used by all programs, they are merged from every program
+void symbol_index_shared_occurrences(benchmark::State& state)
+{
+    const auto& index = get_index();
+    std::vector<const index_symbol*> symbols;
+    for (size_t s = 0; s < shared_symbols; ++s)
+        symbols.push_back(index.defined_at(shared_member, position(s, 0)));
+    size_t i = 0;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(index.occurrences(*symbols[i++ % shared_symbols]));
+}
+BENCHMARK(symbol_index_shared_occurrences)->Unit(benchmark::kMicrosecond);
+
+} // namespace
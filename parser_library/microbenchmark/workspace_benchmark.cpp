@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "context/hlasm_context.h"
+#include "workspaces/file_manager_impl.h"
+#include "workspaces/wildcard.h"
+#include "workspaces/workspace.h"
+
+// benchmarks of macro and copy member lookup in workspaces whose pgm_conf.json
+// defines many wildcard programs, the looked up program matches the last wildcard
+// first_diagnostics: time from opening a program to its diagnostics in a workspace whose libraries are on the disk,
+// with cold libraries and with libraries listed by the warm-up of the workspace
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+
+namespace {
+
+const std::string ws_path = "bench_ws";
+
+std::string make_pgm_conf(int64_t wildcards)
+{
+    std::string conf = R"({"pgms":[)";
+    for (int64_t i = 0; i < wildcards; ++i)
+    {
+        if (i)
+            conf.append(",");
+        conf.append(R"({"program":"pgms)").append(std::to_string(i)).append(R"(/*.asm","pgroup":"P1"})");
+    }
+    conf.append("]}");
+    return conf;
+}
+
+const std::string proc_grps = R"({"pgroups":[{"name":"P1","libs":["bench_ws_libs"]}]})";
+
+void workspace_has_library(benchmark::State& state)
+{
+    file_manager_impl file_mngr;
+    auto conf_dir = std::filesystem::path(ws_path) / ".hlasmplugin";
+    auto pgm_conf = make_pgm_conf(state.range(0));
+    file_mngr.did_open_file((conf_dir / "proc_grps.json").string(), 1, proc_grps);
+    file_mngr.did_open_file((conf_dir / "pgm_conf.json").string(), 1, pgm_conf);
+
+    workspace ws(ws_path, file_mngr);
+    ws.open();
+
+    auto program =
+        (std::filesystem::path(ws_path) / ("pgms" + std::to_string(state.range(0) - 1)) / "program.asm").string();
+    context::hlasm_context ctx(program);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ws.has_library("MAC", ctx));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(workspace_has_library)->Arg(10)->Arg(100)->Arg(500);
+
+// workspace with libraries of small macros, the program uses macros from the last library
+std::filesystem::path make_disk_workspace(size_t libraries, size_t members)
+{
+    auto root = std::filesystem::temp_directory_path() / "hlasm_bench_warm_up";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / ".hlasmplugin");
+
+    std::string libs;
+    for (size_t l = 0; l < libraries; ++l)
+    {
+        auto lib = "lib" + std::to_string(l);
+        libs.append(l ? "," : "").append("\"").append(lib).append("\"");
+        std::filesystem::create_directories(root / lib);
+        for (size_t m = 0; m < members; ++m)
+        {
+            auto name = "M" + std::to_string(l) + "X" + std::to_string(m);
+            std::ofstream(root / lib / name) << " MACRO\n " << name << " &P\n LR &P,&P\n MEND\n";
+        }
+    }
+    std::ofstream(root / ".hlasmplugin" / "proc_grps.json") << R"({"pgroups":[{"name":"P1","libs":[)" << libs << "]}]}";
+    std::ofstream(root / ".hlasmplugin" / "pgm_conf.json") << R"({"pgms":[{"program":"*","pgroup":"P1"}]})";
+    return root;
+}
+
+std::string make_program(size_t last_library, size_t used_members)
+{
+    std::string text;
+    for (size_t m = 0; m < used_members; ++m)
+        text.append(" M").append(std::to_string(last_library)).append("X").append(std::to_string(m)).append(" 1\n");
+    return text;
+}
+
+// argument: 0 for cold libraries, 1 for libraries listed by the warm-up
+void first_diagnostics(benchmark::State& state)
+{
+    constexpr size_t libraries = 20;
+    constexpr size_t members = 200;
+    constexpr size_t used_members = 50;
+    const bool warm = state.range(0) != 0;
+
+    auto root = make_disk_workspace(libraries, members);
+    auto program = (root / "program.asm").string();
+    auto text = make_program(libraries - 1, used_members);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        {
+            file_manager_impl file_mngr;
+            workspace ws(root.string(), file_mngr);
+            ws.open();
+            if (warm)
+                while (ws.warm_up_step())
+                    ;
+            state.ResumeTiming();
+
+            file_mngr.did_open_file(program, 1, text);
+            ws.did_open_file(program);
+            ws.diags().clear();
+            ws.collect_diags();
+            benchmark::DoNotOptimize(file_mngr.find_processor_file(program)->diags().size());
+
+            state.PauseTiming();
+        }
+        state.ResumeTiming();
+    }
+
+    std::filesystem::remove_all(root);
+}
+BENCHMARK(first_diagnostics)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+void wildcard_match(benchmark::State& state)
+{
+    wildcard w("pgms*/sub*/*.asm");
+    std::string path = "pgms123/subfolder/some_long_program_name.asm";
+    for (auto _ : state)
+        benchmark::DoNotOptimize(w.match(path));
+}
+BENCHMARK(wildcard_match);
+
+} // namespace
@@ -66,11 +66,12 @@ analyzer::analyzer(const std::string& text,
     std::string file_name,
     parse_lib_provider& lib_provider,
     processing::processing_tracer* tracer,
-    bool collect_hl_info)
+    bool collect_hl_info,
+    analyzer_options options)
     : analyzer(text,
         file_name,
         lib_provider,
-        new context::hlasm_context(file_name),
+        new context::hlasm_context(file_name, options),
         library_data { processing::processing_kind::ORDINARY, context::id_storage::empty_id },
         true,
         tracer,
@@ -83,7 +84,13 @@ parsing::hlasmparser& analyzer::parser() { return *parser_; }
 
 semantics::lsp_info_processor& analyzer::lsp_processor() { return lsp_proc_; }
 
-void analyzer::analyze(std::atomic<bool>* cancel) { mngr_.start_processing(cancel); }
+void analyzer::analyze(std::atomic<bool>* cancel)
+{
+    mngr_.start_processing(cancel);
+    // the symbols of macros and copy members are collected into the shared context, its owner indexes them all
+    if (hlasm_ctx_ && hlasm_ctx_->lsp_ctx)
+        hlasm_ctx_->lsp_ctx->build_symbol_indices();
+}
 
 void analyzer::collect_diags() const
 {
@@ -94,5 +101,22 @@ void analyzer::collect_diags() const
 const performance_metrics& analyzer::get_metrics()
 {
     hlasm_ctx_ref_.fill_metrics_files();
+    hlasm_ctx_ref_.fill_metrics_identifiers();
     return hlasm_ctx_ref_.metrics;
 }
+
+memory_usage analyzer::get_memory_usage()
+{
+    memory_usage usage;
+    // the context is shared with the analyzers of invoked macros and copy members, it is charged to its owner
+    if (hlasm_ctx_)
+    {
+        usage.context = hlasm_ctx_->memory_estimate();
+        usage.lsp = hlasm_ctx_->lsp_ctx->memory_estimate();
+    }
+    usage.lsp += lsp_proc_.memory_estimate();
+    usage.highlighting = lsp_proc_.highlighting_memory();
+    usage.tokens = input_.size() * sizeof(char32_t) + tokens_.memory_estimate();
+    usage.cached_statements = hlasm_ctx_ref_.cached_definitions_memory(*lsp_proc_.file_name);
+    return usage;
+}
@@ -51,11 +51,13 @@ public:
         const workspaces::library_data data,
         bool collect_hl_info = false);
 
+    // the options apply to the whole analysis, including the macros and copy members it uses
     analyzer(const std::string& text,
         std::string file_name = "",
         workspaces::parse_lib_provider& lib_provider = workspaces::empty_parse_lib_provider::instance,
         processing::processing_tracer* tracer = nullptr,
-        bool collect_hl_info = false);
+        bool collect_hl_info = false,
+        analyzer_options options = {});
 
     context::hlasm_context& context();
     parsing::hlasmparser& parser();
@@ -65,6 +67,8 @@ public:
 
     void collect_diags() const override;
     const performance_metrics& get_metrics();
+    // estimates memory held by the analysis of the file
+    memory_usage get_memory_usage();
 
 private:
     analyzer(const std::string& text,
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_ANALYZER_OPTIONS_H
+#define HLASMPLUGIN_PARSERLIBRARY_ANALYZER_OPTIONS_H
+
+#include <cstddef>
+
+namespace hlasm_plugin::parser_library {
+
+// prediction used when parsing operand fields of statements
+enum class prediction_mode
+{
+    // full LL prediction with error recovery
+    LL,
+    // SLL prediction that bails out on the first syntax error,
+    // only the operand fields that fail are parsed again with full LL prediction
+    SLL_THEN_LL
+};
+
+// settings of one analysis, shared by the analyses of the macros and copy members it uses
+struct analyzer_options
+{
+    // number of threads checking postponed statements at the end of the analysis, 1 checks them sequentially
+    size_t checking_threads = 1;
+    // prediction of the parsers of the analysis
+    prediction_mode prediction = prediction_mode::SLL_THEN_LL;
+};
+
+} // namespace hlasm_plugin::parser_library
+
+#endif
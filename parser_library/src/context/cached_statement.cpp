@@ -14,6 +14,8 @@
 
 #include "cached_statement.h"
 
+#include "memory_estimate.h"
+#include "processing/statement.h"
 #include "semantics/statement.h"
 
 using namespace hlasm_plugin::parser_library;
@@ -44,4 +46,39 @@ cached_statement_storage::cache_entry_t cached_statement_storage::get(processing
     return nullptr;
 }
 
+shared_stmt_ptr cached_statement_storage::get_resolved(
+    const processing::processing_format& format, const processing::op_code& opcode) const
+{
+    for (const auto& entry : resolved_)
+        if (entry->format == format && entry->opcode.value == opcode.value && entry->opcode.type == opcode.type)
+            return entry;
+    return nullptr;
+}
+
+void cached_statement_storage::insert_resolved(resolved_entry_t statement)
+{
+    for (auto& entry : resolved_)
+        if (entry->format == statement->format)
+        {
+            entry = std::move(statement);
+            return;
+        }
+    resolved_.push_back(std::move(statement));
+}
+
 shared_stmt_ptr cached_statement_storage::get_base() const { return base_stmt_; }
+
+size_t cached_statement_storage::memory_estimate() const
+{
+    size_t size = sizeof(*this) + vector_memory(cache_) + vector_memory(resolved_);
+    // the base statement may be shared by more definitions, it is counted for each of them
+    if (auto deferred = base_stmt_->access_deferred())
+        size += sizeof(semantics::statement_si_deferred) + string_memory(deferred->deferred_ref());
+    else if (auto resolved = base_stmt_->access_resolved())
+        size += sizeof(processing::resolved_statement_impl) + bytes_per_operand * resolved->operands_ref().value.size();
+    for (const auto& [format, stmt] : cache_)
+        size += sizeof(semantics::statement_si_defer_done) + bytes_per_operand * stmt->operands.value.size();
+    // resolved statements share the operands with the reparsed forms
+    size += resolved_.size() * sizeof(processing::resolved_statement_impl);
+    return size;
+}
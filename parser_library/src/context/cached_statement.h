@@ -16,10 +16,14 @@
 #define CONTEXT_PROCESSING_CACHED_STATEMENT_H
 
 #include "hlasm_statement.h"
+#include "processing/op_code.h"
 #include "processing/processing_format.h"
 
 namespace hlasm_plugin {
 namespace parser_library {
+namespace processing {
+struct resolved_statement_impl;
+}
 namespace semantics {
 struct statement_si_defer_done;
 }
@@ -36,8 +40,12 @@ public:
     // processing format serves as an identifier of reparsing kind
     using cached_statement_t = std::pair<processing::processing_form, cache_entry_t>;
 
+    // statement resolved from a reparsed form, it carries the processing format and operation code
+    using resolved_entry_t = std::shared_ptr<const processing::resolved_statement_impl>;
+
 private:
     std::vector<cached_statement_t> cache_;
+    std::vector<resolved_entry_t> resolved_;
     shared_stmt_ptr base_stmt_;
 
 public:
@@ -49,7 +57,18 @@ public:
 
     cache_entry_t get(processing::processing_form format) const;
 
+    // returns statement previously resolved with the same format and operation code, nullptr otherwise
+    // lets repeated expansions of a definition reuse one resolved statement instead of allocating a new one
+    shared_stmt_ptr get_resolved(const processing::processing_format& format, const processing::op_code& opcode) const;
+
+    // stores the resolved statement, replaces the one resolved with the same format
+    // the operation code of the statement must be a permanent identifier of a known instruction
+    void insert_resolved(resolved_entry_t statement);
+
     shared_stmt_ptr get_base() const;
+
+    // estimates memory held by the base statement and its reparsed forms
+    size_t memory_estimate() const;
 };
 
 using cached_block = std::vector<cached_statement_storage>;
@@ -32,38 +32,55 @@ std::string to_upper_copy(std::string s)
     return std::move(s);
 }
 
+C_ref make_C_ref(C_t value) { return std::make_shared<C_t>(std::move(value)); }
+
 SET_t::SET_t(context::A_t value)
     : a_value(value)
-    , b_value(object_traits<B_t>::default_v())
-    , c_value(object_traits<C_t>::default_v())
     , type(SET_t_enum::A_TYPE)
 {}
 
 SET_t::SET_t(context::B_t value)
-    : a_value(object_traits<A_t>::default_v())
-    , b_value(value)
-    , c_value(object_traits<C_t>::default_v())
+    : b_value(value)
     , type(SET_t_enum::B_TYPE)
 {}
 
 SET_t::SET_t(context::C_t value)
     : a_value(object_traits<A_t>::default_v())
-    , b_value(object_traits<B_t>::default_v())
-    , c_value(value)
+    , c_value(make_C_ref(std::move(value)))
+    , type(SET_t_enum::C_TYPE)
+{}
+
+SET_t::SET_t(C_ref value)
+    : a_value(object_traits<A_t>::default_v())
+    , c_value(value ? std::move(value) : object_traits<C_t>::default_ref())
     , type(SET_t_enum::C_TYPE)
 {}
 
 SET_t::SET_t()
     : a_value(object_traits<A_t>::default_v())
-    , b_value(object_traits<B_t>::default_v())
-    , c_value(object_traits<C_t>::default_v())
     , type(SET_t_enum::UNDEF_TYPE)
 {}
 
-A_t& SET_t::access_a() { return a_value; }
+A_t SET_t::access_a() const { return type == SET_t_enum::A_TYPE ? a_value : object_traits<A_t>::default_v(); }
+
+B_t SET_t::access_b() const { return type == SET_t_enum::B_TYPE ? b_value : object_traits<B_t>::default_v(); }
+
+const C_t& SET_t::access_c() const { return c_value ? *c_value : object_traits<C_t>::default_v(); }
 
-B_t& SET_t::access_b() { return b_value; }
+const C_ref& SET_t::access_c_ref() const { return c_value ? c_value : object_traits<C_t>::default_ref(); }
 
-C_t& SET_t::access_c() { return c_value; }
+C_t SET_t::take_c()
+{
+    if (!c_value)
+        return object_traits<C_t>::default_v();
+    // buffers are created by make_C_ref as non-const strings, so the only owner may move the characters out
+    if (c_value.use_count() == 1)
+    {
+        auto value = std::move(const_cast<C_t&>(*c_value));
+        c_value.reset();
+        return value;
+    }
+    return *c_value;
+}
 
 } // namespace hlasm_plugin::parser_library::context
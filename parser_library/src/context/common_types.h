@@ -15,6 +15,7 @@
 #ifndef CONTEXT_COMMON_TYPES_H
 #define CONTEXT_COMMON_TYPES_H
 
+#include <memory>
 #include <string>
 
 namespace hlasm_plugin {
@@ -27,6 +28,12 @@ using A_t = int32_t;
 using B_t = bool;
 // type for SETC symbol
 using C_t = std::string;
+// reference-counted immutable SETC value
+// SET_t values and SETC symbols share the buffer instead of copying the characters
+using C_ref = std::shared_ptr<const C_t>;
+
+// buffers must be created by this function, SET_t::take_c moves the characters out of buffers that are not shared
+C_ref make_C_ref(C_t value);
 
 // enum of SET symbols
 enum class SET_t_enum
@@ -86,27 +93,41 @@ template<> struct object_traits<C_t>
         static C_t def("");
         return def;
     }
+    static const C_ref& default_ref()
+    {
+        static const C_ref def = make_C_ref("");
+        return def;
+    }
 };
 
-// struct agregating SET types for easier usage
+// tagged value of one of the SET types
+// SETC value is held in a shared buffer, so copies of SET_t do not copy the characters
 struct SET_t
 {
 private:
-    A_t a_value;
-    B_t b_value;
-    C_t c_value;
+    union
+    {
+        A_t a_value;
+        B_t b_value;
+    };
+    C_ref c_value;
 
 public:
     SET_t(A_t value);
     SET_t(B_t value);
     SET_t(C_t value);
+    SET_t(C_ref value);
     SET_t();
 
     const SET_t_enum type;
 
-    A_t& access_a();
-    B_t& access_b();
-    C_t& access_c();
+    A_t access_a() const;
+    B_t access_b() const;
+    const C_t& access_c() const;
+    // returns shared buffer of the SETC value
+    const C_ref& access_c_ref() const;
+    // returns the SETC value, the characters are moved out when the buffer is not shared
+    C_t take_c();
 };
 
 // just mock method for now, will be implemented later with respect to UTF/EBCDIC
@@ -20,6 +20,7 @@
 #include "ebcdic_encoding.h"
 #include "expressions/arithmetic_expression.h"
 #include "instruction.h"
+#include "memory_estimate.h"
 
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::context;
@@ -243,9 +244,10 @@ bool hlasm_context::is_opcode(id_index symbol) const
     return macros_.find(symbol) != macros_.end() || instruction_map_.find(symbol) != instruction_map_.end();
 }
 
-hlasm_context::hlasm_context(std::string file_name)
+hlasm_context::hlasm_context(std::string file_name, analyzer_options options)
     : instruction_map_(init_instruction_map())
     , SYSNDX_(0)
+    , options_(options)
     , ord_ctx(ids_)
     , lsp_ctx(std::make_shared<lsp_context>())
 {
@@ -255,6 +257,8 @@ hlasm_context::hlasm_context(std::string file_name)
     add_global_system_vars();
 }
 
+const analyzer_options& hlasm_context::options() const { return options_; }
+
 void hlasm_context::set_source_position(position pos) { source_stack_.back().current_instruction.pos = pos; }
 
 void hlasm_context::set_source_indices(size_t begin_index, size_t end_index, size_t end_line)
@@ -344,6 +348,13 @@ void hlasm_plugin::parser_library::context::hlasm_context::fill_metrics_files()
     metrics.lines += metrics.files;
 }
 
+void hlasm_context::fill_metrics_identifiers()
+{
+    metrics.identifiers = ids_.size();
+    metrics.identifiers_peak = ids_.peak_size();
+    metrics.identifier_memory = ids_.memory_estimate();
+}
+
 const code_scope::set_sym_storage& hlasm_context::globals() const { return globals_; }
 
 var_sym_ptr hlasm_context::get_var_sym(id_index name)
@@ -461,7 +472,8 @@ opcode_t hlasm_context::get_operation_code(id_index symbol) const
     return value;
 }
 
-SET_t hlasm_context::get_data_attribute(data_attr_kind attribute, var_sym_ptr var_symbol, std::vector<size_t> offset)
+SET_t hlasm_context::get_data_attribute(
+    data_attr_kind attribute, var_sym_ptr var_symbol, const std::vector<size_t>& offset)
 {
     switch (attribute)
     {
@@ -470,7 +482,7 @@ SET_t hlasm_context::get_data_attribute(data_attr_kind attribute, var_sym_ptr va
         case data_attr_kind::N:
             return var_symbol ? var_symbol->number(offset) : 0;
         case hlasm_plugin::parser_library::context::data_attr_kind::T:
-            return get_type_attr(var_symbol, std::move(offset));
+            return get_type_attr(var_symbol, offset);
         default:
             break;
     }
@@ -678,3 +690,50 @@ void hlasm_context::apply_source_snapshot(source_snapshot snapshot)
 }
 
 const code_scope& hlasm_context::current_scope() const { return *curr_scope(); }
+
+namespace {
+// global variables are counted only once, in the storage of globals
+size_t variables_memory(const code_scope::set_sym_storage& variables, bool globals)
+{
+    size_t size = hash_map_memory(variables);
+    for (const auto& [name, var] : variables)
+        if (var->is_global == globals)
+            size += sizeof(set_symbol<C_t>) + var->size() * sizeof(C_t);
+    return size;
+}
+} // namespace
+
+size_t hlasm_context::memory_estimate() const
+{
+    size_t size = ids_.memory_estimate() + ord_ctx.memory_estimate() + hash_map_memory(instruction_map_)
+        + hash_map_memory(opcode_mnemo_) + variables_memory(globals_, true) + tree_memory(visited_files_);
+
+    for (const auto& file : visited_files_)
+        size += string_memory(file);
+
+    for (const auto& scope : scope_stack_)
+        size += sizeof(code_scope) + variables_memory(scope.variables, false)
+            + hash_map_memory(scope.system_variables) + hash_map_memory(scope.sequence_symbols);
+
+    size += hash_map_memory(macros_) + hash_map_memory(copy_members_);
+    for (const auto& [name, macro] : macros_)
+        size += sizeof(macro_definition) + hash_map_memory(macro->named_params())
+            + macro->named_params().size() * sizeof(keyword_param) + hash_map_memory(macro->labels)
+            + macro->labels.size() * sizeof(sequence_symbol);
+
+    return size;
+}
+
+size_t hlasm_context::cached_definitions_memory(const std::string& file_name) const
+{
+    size_t size = 0;
+    for (const auto& [name, macro] : macros_)
+        if (macro->definition_location.file == file_name)
+            for (const auto& stmt : macro->cached_definition)
+                size += stmt.memory_estimate();
+    for (const auto& [name, member] : copy_members_)
+        if (member.definition_location.file == file_name)
+            for (const auto& stmt : member.cached_definition)
+                size += stmt.memory_estimate();
+    return size;
+}
@@ -20,6 +20,7 @@
 #include <set>
 #include <vector>
 
+#include "analyzer_options.h"
 #include "code_scope.h"
 #include "lsp_context.h"
 #include "operation_code.h"
@@ -80,8 +81,13 @@ class hlasm_context
 
     bool is_opcode(id_index symbol) const;
 
+    const analyzer_options options_;
+
 public:
-    hlasm_context(std::string file_name = "");
+    hlasm_context(std::string file_name = "", analyzer_options options = {});
+
+    // settings of the analysis
+    const analyzer_options& options() const;
 
     // gets name of file where is open-code located
     const std::string& opencode_file_name() const;
@@ -129,6 +135,7 @@ public:
     performance_metrics metrics;
 
     void fill_metrics_files();
+    void fill_metrics_identifiers();
     // return map of global set vars
     const code_scope::set_sym_storage& globals() const;
 
@@ -155,7 +162,8 @@ public:
     opcode_t get_operation_code(id_index symbol) const;
 
     // get data attribute value of variable symbol
-    SET_t get_data_attribute(data_attr_kind attribute, var_sym_ptr var_symbol, std::vector<size_t> offset = {});
+    SET_t get_data_attribute(
+        data_attr_kind attribute, var_sym_ptr var_symbol, const std::vector<size_t>& offset = {});
     // get data attribute value of ordinary symbol
     SET_t get_data_attribute(data_attr_kind attribute, id_index symbol);
 
@@ -191,6 +199,11 @@ public:
     // leaves current copy member
     void leave_copy_member();
 
+    // estimates memory held by identifiers, symbol and instruction tables, variables and macro parameters
+    size_t memory_estimate() const;
+    // estimates memory held by cached statements of macros and copy members defined in the file
+    size_t cached_definitions_memory(const std::string& file_name) const;
+
     // creates specified global set symbol
     template<typename T> set_sym_ptr create_global_variable(id_index id, bool is_scalar)
     {
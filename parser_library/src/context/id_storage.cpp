@@ -14,7 +14,10 @@
 
 #include "id_storage.h"
 
+#include <algorithm>
+
 #include "common_types.h"
+#include "memory_estimate.h"
 
 using namespace hlasm_plugin::parser_library::context;
 
@@ -55,6 +58,46 @@ id_storage::const_pointer id_storage::add(std::string value, bool is_uri)
     return &*lit_.insert(std::move(value)).first;
 }
 
+id_storage::const_pointer id_storage::add_scratch(std::string value)
+{
+    if (value.empty())
+        return empty_id;
+    to_upper(value);
+    if (auto found = lit_.find(value); found != lit_.end())
+        return &*found;
+    return &*scratch_.insert(std::move(value)).first;
+}
+
+bool id_storage::is_scratch(const_pointer id) const
+{
+    if (id == nullptr || scratch_.empty())
+        return false;
+    auto found = scratch_.find(*id);
+    return found != scratch_.end() && &*found == id;
+}
+
+void id_storage::release_scratch()
+{
+    if (scratch_.empty())
+        return;
+    peak_size_ = peak_size();
+    scratch_.clear();
+}
+
+size_t id_storage::scratch_size() const { return scratch_.size(); }
+
+size_t id_storage::peak_size() const { return std::max(peak_size_, lit_.size() + scratch_.size()); }
+
+size_t id_storage::memory_estimate() const
+{
+    size_t size = hash_map_memory(lit_) + hash_map_memory(scratch_);
+    for (const auto& id : lit_)
+        size += string_memory(id);
+    for (const auto& id : scratch_)
+        size += string_memory(id);
+    return size;
+}
+
 hlasm_plugin::parser_library::context::id_storage::well_known_strings::well_known_strings(
     std::unordered_set<std::string>& ptr)
     : COPY(&*ptr.emplace("COPY").first)
@@ -25,10 +25,14 @@ namespace context {
 
 // storage for identifiers
 // changes strings of identifiers to indexes of this storage class for easier and unified work
+// identifiers are permanent, their addresses serve as keys in the whole context
+// names generated during processing of a statement that are not needed afterwards can be stored as scratch identifiers
 class id_storage
 {
 private:
     std::unordered_set<std::string> lit_;
+    std::unordered_set<std::string> scratch_;
+    size_t peak_size_ = 0;
     static const std::string empty_string_;
 
 public:
@@ -48,6 +52,20 @@ public:
 
     const_pointer add(std::string value, bool is_uri = false);
 
+    // returns permanent identifier if the value is already stored, otherwise stores the value as a scratch identifier
+    // scratch identifiers are valid until release_scratch is called, they must not be kept in any long-lived structure
+    const_pointer add_scratch(std::string value);
+    bool is_scratch(const_pointer id) const;
+    // reclaims all scratch identifiers
+    void release_scratch();
+    size_t scratch_size() const;
+
+    // largest number of identifiers held at once, including the scratch ones
+    size_t peak_size() const;
+
+    // estimates memory held by the stored identifiers
+    size_t memory_estimate() const;
+
     struct well_known_strings
     {
         const std::string* COPY;
@@ -14,8 +14,15 @@
 
 #include "lsp_context.h"
 
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+
 #include "ebcdic_encoding.h"
+#include "memory_estimate.h"
+#include "ordinary_assembly/symbol.h"
 
+using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::context;
 
 size_t definition::hash() const { return (size_t)name; }
@@ -74,11 +81,13 @@ bool var_definition::operator==(const var_definition& other) const
     return name == other.name && scope == other.scope;
 }
 
-std::vector<std::string> ord_definition::get_value() const
+std::vector<std::string> ord_definition::get_value(const symbol* value) const
 {
-    if (val.value_kind() == symbol_value_kind::UNDEF || !attr.has_value())
-        return { { definition::get_value() } };
+    if (!value || value->value().value_kind() == symbol_value_kind::UNDEF)
+        return definition::get_value();
 
+    const auto& val = value->value();
+    const auto& attr = value->attributes();
     std::vector<std::string> result;
     if (val.value_kind() == context::symbol_value_kind::ABS)
     {
@@ -91,15 +100,15 @@ std::vector<std::string> ord_definition::get_value() const
         result.push_back("Relocatable Symbol");
     }
     // extract its attributes
-    if (attr->is_defined(context::data_attr_kind::L))
-        result.push_back("L: " + std::to_string(attr->get_attribute_value(context::data_attr_kind::L)));
-    if (attr->is_defined(context::data_attr_kind::I))
-        result.push_back("I: " + std::to_string(attr->get_attribute_value(context::data_attr_kind::I)));
-    if (attr->is_defined(context::data_attr_kind::S))
-        result.push_back("S: " + std::to_string(attr->get_attribute_value(context::data_attr_kind::S)));
-    if (attr->is_defined(context::data_attr_kind::T))
+    if (attr.is_defined(context::data_attr_kind::L))
+        result.push_back("L: " + std::to_string(attr.get_attribute_value(context::data_attr_kind::L)));
+    if (attr.is_defined(context::data_attr_kind::I))
+        result.push_back("I: " + std::to_string(attr.get_attribute_value(context::data_attr_kind::I)));
+    if (attr.is_defined(context::data_attr_kind::S))
+        result.push_back("S: " + std::to_string(attr.get_attribute_value(context::data_attr_kind::S)));
+    if (attr.is_defined(context::data_attr_kind::T))
         result.push_back(
-            "T: " + ebcdic_encoding::to_ascii((unsigned char)attr->get_attribute_value(context::data_attr_kind::T)));
+            "T: " + ebcdic_encoding::to_ascii((unsigned char)attr.get_attribute_value(context::data_attr_kind::T)));
 
     return result;
 }
@@ -108,15 +117,16 @@ size_t ord_definition::hash() const { return (size_t)name; }
 
 bool ord_definition::operator==(const ord_definition& other) const { return name == other.name; }
 
-std::vector<std::string> instr_definition::get_value() const
+std::vector<std::string> instr_definition::get_value(const lsp_context& ctx) const
 {
-    if (!item.has_value())
+    if (item == no_item)
         return { { "" } };
 
-    std::vector<std::string> result = { item->detail };
+    const auto& instr = ctx.all_instructions[item];
+    std::vector<std::string> result = { instr.detail };
     if (version != -1)
         result.push_back("version " + std::to_string(version));
-    auto doc = item->get_contents();
+    auto doc = instr.get_contents();
     result.insert(result.end(), std::make_move_iterator(doc.begin()), std::make_move_iterator(doc.end()));
     return result;
 }
@@ -209,3 +219,84 @@ void completion_item_s::implode_contents()
         content_string = result.str();
     }
 }
+
+size_t completion_item_s::memory_estimate() const
+{
+    size_t size = vector_memory(content) + string_memory(label) + string_memory(detail) + string_memory(insert_text)
+        + string_memory(content_string);
+    for (const auto& line : content)
+        size += string_memory(line);
+    return size;
+}
+
+namespace {
+template<typename T> void build_index(std::vector<const T*>& index, const definitions<T>& symbols)
+{
+    index.clear();
+    index.reserve(symbols.size());
+    for (const auto& [symbol, occurences] : symbols)
+        index.push_back(&symbol);
+    // symbols of the same name are ordered by their definitions, the order of the map is not deterministic
+    std::sort(index.begin(), index.end(), [](const T* lhs, const T* rhs) {
+        const auto& l = lhs->definition_range.start;
+        const auto& r = rhs->definition_range.start;
+        return std::tie(*lhs->name, *lhs->file_name, l.line, l.column)
+            < std::tie(*rhs->name, *rhs->file_name, r.line, r.column);
+    });
+}
+
+template<typename T> size_t definitions_memory(const definitions<T>& symbols)
+{
+    size_t size = hash_map_memory(symbols);
+    for (const auto& [symbol, occurences] : symbols)
+        size += vector_memory(occurences);
+    return size;
+}
+} // namespace
+
+size_t lsp_context::add_instruction(completion_item_s item)
+{
+    all_instructions.push_back(std::move(item));
+    const auto& label = all_instructions.back().label;
+    // items with the same label stay in the order of their definition
+    auto it = std::upper_bound(instruction_index.begin(),
+        instruction_index.end(),
+        label,
+        [this](const std::string& l, size_t i) { return l < all_instructions[i].label; });
+    instruction_index.insert(it, all_instructions.size() - 1);
+    return all_instructions.size() - 1;
+}
+
+size_t lsp_context::find_instruction_item(std::string_view label) const
+{
+    auto it = std::lower_bound(instruction_index.begin(),
+        instruction_index.end(),
+        label,
+        [this](size_t i, std::string_view l) { return all_instructions[i].label < l; });
+    if (it == instruction_index.end() || all_instructions[*it].label != label)
+        return instr_definition::no_item;
+    return *it;
+}
+
+const completion_item_s* lsp_context::find_instruction(std::string_view label) const
+{
+    auto item = find_instruction_item(label);
+    return item == instr_definition::no_item ? nullptr : &all_instructions[item];
+}
+
+void lsp_context::build_symbol_indices()
+{
+    build_index(var_index, var_symbols);
+    build_index(seq_index, seq_symbols);
+}
+
+size_t lsp_context::memory_estimate() const
+{
+    size_t size = definitions_memory(seq_symbols) + definitions_memory(var_symbols) + definitions_memory(ord_symbols)
+        + definitions_memory(instructions) + vector_memory(deferred_seqs) + vector_memory(deferred_ord_defs)
+        + vector_memory(deferred_ord_occs) + vector_memory(all_instructions) + vector_memory(instruction_index)
+        + vector_memory(var_index) + vector_memory(seq_index);
+    for (const auto& item : all_instructions)
+        size += item.memory_estimate();
+    return size;
+}
@@ -16,6 +16,7 @@
 #define CONTEXT_LSP_CONTEXT_H
 
 #include <stack>
+#include <string_view>
 
 #include "semantics/highlighting_info.h"
 
@@ -23,6 +24,9 @@ namespace hlasm_plugin {
 namespace parser_library {
 namespace context {
 
+class symbol;
+struct lsp_context;
+
 // type of symbols that come from the parser
 // sequence symbol, variable symbol, ordinary symbol, instruction symbol and highlighting symbol
 enum class symbol_type
@@ -122,12 +126,16 @@ public:
     std::vector<std::string> get_contents() const;
     // helper function, recreates the content vector to content string
     void implode_contents();
+    // estimates memory held by the texts of the item
+    size_t memory_estimate() const;
     // several features of completion item from LSP
     std::string label;
     std::string detail;
     std::string insert_text;
     bool deprecated = false;
     size_t kind = 1;
+    // only instructions have documentation to be resolved later, symbols carry everything in their detail
+    bool instruction = false;
     // content in one string
     std::string content_string;
 };
@@ -169,6 +177,7 @@ struct definition
 };
 
 // derived representation of the ordinary symbol
+// the value and attributes are not stored, they are looked up in the ordinary context when the hover text is requested
 struct ord_definition : public definition
 {
     // the definition constructors
@@ -183,25 +192,11 @@ struct ord_definition : public definition
         : definition(sym)
     {}
 
-    // constructor with addition of symbol value and symbol attributes
-    inline ord_definition(const std::string* name,
-        const std::string* file_name,
-        const range& definition_range,
-        const symbol_value val,
-        const symbol_attributes attr)
-        : definition(name, file_name, definition_range)
-        , val(val)
-        , attr(attr)
-    {}
-
-    virtual std::vector<std::string> get_value() const override;
+    using definition::get_value;
+    // returns value and attributes of the symbol, value is the symbol found in the ordinary context or nullptr
+    std::vector<std::string> get_value(const symbol* value) const;
     virtual size_t hash() const override;
     bool operator==(const ord_definition& other) const;
-
-    // value of a symbol
-    const symbol_value val;
-    // attributes of symbol
-    std::optional<const symbol_attributes> attr;
 };
 
 // variations of variable symbols: number, string, boolean or macro param
@@ -280,6 +275,9 @@ struct seq_definition : public definition
 // derived representation of the instruction symbol
 struct instr_definition : public definition
 {
+    // the instruction has no completion item
+    static constexpr size_t no_item = (size_t)-1;
+
     // the definition constructors
     inline instr_definition()
         : definition(nullptr)
@@ -290,19 +288,21 @@ struct instr_definition : public definition
         , version(0)
     {}
 
-    // constructor with addition of the completion item describing the instruction and the version of the instruction
-    // (macros only)
+    // constructor with addition of the position of the completion item describing the instruction in
+    // lsp_context::all_instructions and the version of the instruction (macros only)
     inline instr_definition(const std::string* name,
         const std::string* file_name,
         const range definition_range,
-        const completion_item_s& item,
+        size_t item,
         size_t version)
         : definition(name, file_name, definition_range)
         , item(item)
         , version(version)
     {}
 
-    virtual std::vector<std::string> get_value() const override;
+    using definition::get_value;
+    // returns description and documentation of the instruction, they are generated from the completion item on request
+    std::vector<std::string> get_value(const lsp_context& ctx) const;
     virtual size_t hash() const override;
     bool operator==(const instr_definition& other) const;
     // (re)initialize the instruction symbol
@@ -310,8 +310,8 @@ struct instr_definition : public definition
     // clear the contents of the symbol
     void clear(const std::string* empty_string);
 
-    // completion item providing contents about instruction
-    std::optional<completion_item_s> item;
+    // position of the completion item providing contents about instruction in lsp_context::all_instructions
+    size_t item = no_item;
     // version of the instruction
     size_t version;
 };
@@ -347,11 +347,30 @@ struct lsp_context
     bool initialized = false;
     // vecotr of all instructions with their values for completion request
     std::vector<completion_item_s> all_instructions;
+    // indices to all_instructions sorted by label, used for prefix search during completion
+    std::vector<size_t> instruction_index;
+    // definitions of variable and sequence symbols sorted by name, used for prefix search during completion
+    // they are built by build_symbol_indices when the analysis is finished
+    std::vector<const var_definition*> var_index;
+    std::vector<const seq_definition*> seq_index;
 
     inline lsp_context()
         : deferred_macro_statement()
 
     {}
+
+    // adds the instruction to all_instructions and to the index, returns its position in all_instructions
+    size_t add_instruction(completion_item_s item);
+    // finds the first instruction with the given label, returns its position in all_instructions or
+    // instr_definition::no_item if there is none
+    size_t find_instruction_item(std::string_view label) const;
+    // finds the first instruction with the given label, nullptr if there is none
+    const completion_item_s* find_instruction(std::string_view label) const;
+    // sorts the variable and sequence symbol definitions into var_index and seq_index
+    void build_symbol_indices();
+
+    // estimates memory held by the definitions maps, their occurences and completion items
+    size_t memory_estimate() const;
 };
 
 using lsp_ctx_ptr = std::shared_ptr<lsp_context>;
@@ -61,15 +61,16 @@ void space::resolve(space_ptr this_space, int length)
     for (auto& listener : this_space->listeners_)
     {
         auto l_tmp = std::find_if(
-            listener->spaces.begin(), listener->spaces.end(), [&](auto s) { return s.first == this_space; });
+            listener->spaces.begin(), listener->spaces.end(), [&](auto& s) { return s.first == this_space; });
 
         assert(l_tmp != listener->spaces.end());
 
         listener->offset += length;
 
-        listener->spaces.erase(l_tmp);
+        listener->drop_space(l_tmp - listener->spaces.begin());
     }
 
+    this_space->listeners_.clear();
     this_space->resolved_ = true;
 }
 
@@ -80,14 +81,12 @@ void space::resolve(space_ptr this_space, space_ptr value)
 
     assert(this_space->kind == space_kind::LOCTR_UNKNOWN);
 
-    for (int i = this_space->listeners_.size() - 1; i >= 0; --i)
+    for (auto listener : this_space->listeners_)
     {
-        auto listener = this_space->listeners_[i];
         assert(listener->spaces.front().first == this_space);
 
-        listener->spaces.front().first->remove_listener(listener);
         listener->spaces.front().first = value;
-        value->add_listener(listener);
+        listener->listener_slots_.front() = value->add_listener(listener);
     }
 
     this_space->listeners_.clear();
@@ -101,25 +100,26 @@ void space::resolve(space_ptr this_space, address value)
 
     assert(this_space->kind == space_kind::LOCTR_UNKNOWN);
 
-    for (int i = this_space->listeners_.size() - 1; i >= 0; --i)
+    for (auto listener : this_space->listeners_)
     {
-        auto listener = this_space->listeners_[i];
         assert(listener->spaces.front().first == this_space);
 
         assert(listener->bases.size() == value.bases.size());
         listener->offset += value.offset;
-        listener->spaces.erase(listener->spaces.begin());
-        auto spaces = value.spaces;
-        for (auto&& space : listener->spaces)
-            spaces.push_back(std::move(space));
-        listener->spaces = spaces;
-        for (auto&& sp : value.spaces)
-            sp.first->add_listener(listener);
-    }
 
-    for (auto& sp : value.spaces)
-        sp.first->remove_listener(&value);
-    value.spaces.clear();
+        // the resolved space is replaced by the spaces of the value, registrations of the rest are kept
+        address::space_list spaces = value.spaces;
+        for (size_t i = 1; i < listener->spaces.size(); ++i)
+            spaces.push_back(std::move(listener->spaces[i]));
+        listener->spaces = std::move(spaces);
+
+        auto old_slots = std::move(listener->listener_slots_);
+        listener->listener_slots_.clear();
+        for (size_t i = 0; i < value.spaces.size(); ++i)
+            listener->listener_slots_.push_back(listener->spaces[i].first->add_listener(listener));
+        for (size_t i = 1; i < old_slots.size(); ++i)
+            listener->listener_slots_.push_back(old_slots[i]);
+    }
 
     this_space->listeners_.clear();
     this_space->resolved_ = true;
@@ -133,20 +133,32 @@ void space::resolve(space_ptr this_space, std::variant<space_ptr, address> value
         resolve(std::move(this_space), std::move(std::get<address>(value)));
 }
 
-void space::add_listener(address* addr)
+size_t space::add_listener(address* addr)
 {
     assert(!resolved_);
     assert(std::find(listeners_.begin(), listeners_.end(), addr) == listeners_.end());
     assert(std::find_if(addr->spaces.begin(), addr->spaces.end(), [=](auto& sp) { return &*sp.first == this; })
         != addr->spaces.end());
     listeners_.push_back(addr);
+    return listeners_.size() - 1;
+}
+
+void space::remove_listener(size_t slot)
+{
+    assert(slot < listeners_.size());
+    // the last listener takes the freed slot
+    if (auto moved = listeners_.back(); slot != listeners_.size() - 1)
+    {
+        listeners_[slot] = moved;
+        moved->listener_slot(this) = slot;
+    }
+    listeners_.pop_back();
 }
 
-void space::remove_listener(address* addr)
+void space::replace_listener(size_t slot, address* addr)
 {
-    auto it = std::find(listeners_.begin(), listeners_.end(), addr);
-    assert(it != listeners_.end());
-    listeners_.erase(it);
+    assert(slot < listeners_.size());
+    listeners_[slot] = addr;
 }
 
 std::string address::to_string() const
@@ -170,10 +182,7 @@ address::address(base address_base, int offset, const space_storage& spaces)
     bases.emplace_back(address_base, 1);
 
     for (auto& space : spaces)
-    {
-        this->spaces.emplace_back(space, 1);
-        space->add_listener(this);
-    }
+        add_space({ space, 1 });
 }
 
 address::address(const address& addr)
@@ -182,15 +191,16 @@ address::address(const address& addr)
 
 address& address::operator=(const address& addr)
 {
-    for (auto& [sp, count] : spaces)
-        sp->remove_listener(this);
+    if (this == &addr)
+        return *this;
+
+    unregister_spaces();
 
     bases = addr.bases;
     offset = addr.offset;
     spaces = addr.spaces;
 
-    for (auto& [sp, count] : spaces)
-        sp->add_listener(this);
+    register_spaces();
 
     return *this;
 }
@@ -198,35 +208,76 @@ address& address::operator=(const address& addr)
 address::address(address&& addr)
     : bases(std::move(addr.bases))
     , offset(addr.offset)
-    , spaces(std::move(addr.spaces))
 {
-    for (auto& [sp, count] : spaces)
-    {
-        sp->add_listener(this);
-        sp->remove_listener(&addr);
-    }
-
-    addr.spaces = {};
+    take_registrations(addr);
 }
 
 address& address::operator=(address&& addr)
 {
-    for (auto& [sp, count] : spaces)
-        sp->remove_listener(this);
+    if (this == &addr)
+        return *this;
+
+    unregister_spaces();
 
     bases = std::move(addr.bases);
-    offset = std::move(addr.offset);
-    spaces = std::move(addr.spaces);
+    offset = addr.offset;
 
+    take_registrations(addr);
+
+    return *this;
+}
+
+void address::add_space(space_entry entry)
+{
+    spaces.push_back(std::move(entry));
+    listener_slots_.push_back(spaces.back().first->add_listener(this));
+}
+
+void address::remove_space(size_t index)
+{
+    spaces[index].first->remove_listener(listener_slots_[index]);
+    drop_space(index);
+}
+
+void address::register_spaces()
+{
+    listener_slots_.clear();
     for (auto& [sp, count] : spaces)
     {
-        sp->add_listener(this);
-        sp->remove_listener(&addr);
+        assert(count != 0);
+        listener_slots_.push_back(sp->add_listener(this));
     }
+}
 
-    addr.spaces = {};
+void address::unregister_spaces()
+{
+    for (size_t i = 0; i < spaces.size(); ++i)
+        spaces[i].first->remove_listener(listener_slots_[i]);
+    listener_slots_.clear();
+}
 
-    return *this;
+void address::take_registrations(address& addr)
+{
+    spaces = std::move(addr.spaces);
+    listener_slots_ = std::move(addr.listener_slots_);
+    addr.spaces.clear();
+    addr.listener_slots_.clear();
+
+    for (size_t i = 0; i < spaces.size(); ++i)
+        spaces[i].first->replace_listener(listener_slots_[i], this);
+}
+
+void address::drop_space(size_t index)
+{
+    spaces.erase(spaces.begin() + index);
+    listener_slots_.erase(listener_slots_.begin() + index);
+}
+
+size_t& address::listener_slot(const space* sp)
+{
+    auto it = std::find_if(spaces.begin(), spaces.end(), [sp](const auto& e) { return e.first.get() == sp; });
+    assert(it != spaces.end());
+    return listener_slots_[it - spaces.begin()];
 }
 
 enum class op
@@ -241,11 +292,11 @@ template<> bool compare<address::base>(const address::base& lhs, const address::
     return lhs.owner == rhs.owner;
 }
 
-template<typename T>
-std::vector<T> merge_entries(const std::vector<T>& lhs, const std::vector<T>& rhs, const op operation)
+template<typename list_t> list_t merge_entries(const list_t& lhs, const list_t& rhs, const op operation)
 {
-    std::vector<T> res;
-    std::vector<const T*> prhs;
+    using T = typename list_t::value_type;
+    list_t res;
+    hlasm_plugin::parser_library::small_vector<const T*, 4> prhs;
 
     prhs.reserve(rhs.size());
     for (const auto& e : rhs)
@@ -345,20 +396,12 @@ bool address::has_dependant_space() const
     }
 }
 
-address::~address()
-{
-    for (auto& [sp, count] : spaces)
-        sp->remove_listener(this);
-}
+address::~address() { unregister_spaces(); }
 
-address::address(std::vector<base_entry> bases_, int offset_, std::vector<space_entry> spaces_)
+address::address(base_list bases_, int offset_, space_list spaces_)
     : bases(std::move(bases_))
     , offset(offset_)
     , spaces(std::move(spaces_))
 {
-    for (auto& [sp, count] : spaces)
-    {
-        assert(count != 0);
-        sp->add_listener(this);
-    }
+    register_spaces();
 }
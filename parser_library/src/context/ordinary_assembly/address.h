@@ -22,6 +22,7 @@
 
 #include "alignment.h"
 #include "context/id_storage.h"
+#include "small_vector.h"
 
 namespace hlasm_plugin {
 namespace parser_library {
@@ -38,6 +39,9 @@ using aligned_addr = std::pair<address, space_ptr>;
 
 
 // structure representing relative address in a section
+// the address is registered as a listener of each space it contains, so that it is updated when the space is resolved
+// addresses are copied often during evaluation of machine expressions, usually with one base and few spaces, so both
+// lists are stored inside the address
 struct address
 {
     struct base
@@ -49,13 +53,16 @@ struct address
 
     using space_entry = std::pair<space_ptr, int>;
     using base_entry = std::pair<base, int>;
+    using base_list = small_vector<base_entry, 2>;
+    using space_list = small_vector<space_entry, 2>;
 
     // list of bases and their counts to which is the address relative
-    std::vector<base_entry> bases;
+    base_list bases;
     // offset relative to bases
     int offset;
     // list of spaces with their counts this address contains
-    std::vector<space_entry> spaces;
+    // modify it only by the member functions, they keep the registrations in the spaces
+    space_list spaces;
 
     address(base address_base, int offset, const space_storage& spaces);
 
@@ -75,10 +82,33 @@ struct address
     bool is_simple() const;
     bool has_dependant_space() const;
 
+    // appends the space and registers the address in it
+    void add_space(space_entry entry);
+    // removes the space on the index and unregisters the address from it
+    void remove_space(size_t index);
+    template<typename Pred> void remove_spaces_if(Pred pred)
+    {
+        for (size_t i = spaces.size(); i > 0; --i)
+            if (pred(spaces[i - 1]))
+                remove_space(i - 1);
+    }
+
     ~address();
 
 private:
-    address(std::vector<base_entry> bases, int offset, std::vector<space_entry> spaces);
+    friend struct space;
+
+    // positions of this address in the listener registries of the spaces, parallel to spaces
+    small_vector<size_t, 2> listener_slots_;
+
+    address(base_list bases, int offset, space_list spaces);
+
+    void register_spaces();
+    void unregister_spaces();
+    void take_registrations(address& addr);
+    // removes the space without unregistering, used when the space itself is resolved
+    void drop_space(size_t index);
+    size_t& listener_slot(const space* sp);
 };
 
 enum class space_kind
@@ -121,14 +151,18 @@ struct space
     // common resolver for 2 methods above
     static void resolve(space_ptr this_space, std::variant<space_ptr, address> value);
 
-    void add_listener(address* addr);
-    void remove_listener(address* addr);
-
 private:
+    friend struct address;
+
     bool resolved_;
     // loctr to witch the space belong
-    // addresses that contain the space
+    // addresses that contain the space, each address knows its slot, so removal is constant time
     std::vector<address*> listeners_;
+
+    // registers the address and returns its slot
+    size_t add_listener(address* addr);
+    void remove_listener(size_t slot);
+    void replace_listener(size_t slot, address* addr);
 };
 
 
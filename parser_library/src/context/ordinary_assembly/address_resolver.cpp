@@ -40,8 +40,7 @@ address address_resolver::extract_dep_address(const address& addr)
     address tmp(address::base {}, 0, {});
     for (auto it = addr.spaces.rbegin(); it != addr.spaces.rend(); ++it)
     {
-        tmp.spaces.push_back(*it);
-        it->first->add_listener(&tmp);
+        tmp.add_space(*it);
         if (it->first->kind == space_kind::ALIGNMENT || it->first->kind == space_kind::LOCTR_SET
             || it->first->kind == space_kind::LOCTR_MAX)
             break;
@@ -120,13 +120,7 @@ dependency_collector& dependency_collector::div_mul(const dependency_collector&
 
 void dependency_collector::adjust_address(address& addr)
 {
-    auto known_spaces = std::partition(addr.spaces.begin(), addr.spaces.end(), [](auto& entry) {
-        return entry.first->kind == context::space_kind::LOCTR_UNKNOWN;
-    });
-    if (known_spaces != addr.spaces.begin())
-    {
-        std::for_each(
-            known_spaces, addr.spaces.end(), [&addr](auto& entry) { return entry.first->remove_listener(&addr); });
-        addr.spaces.erase(known_spaces, addr.spaces.end());
-    }
+    auto is_unknown = [](const auto& entry) { return entry.first->kind == context::space_kind::LOCTR_UNKNOWN; };
+    if (std::any_of(addr.spaces.begin(), addr.spaces.end(), is_unknown))
+        addr.remove_spaces_if([&is_unknown](const auto& entry) { return !is_unknown(entry); });
 }
@@ -24,6 +24,13 @@ using namespace hlasm_plugin::parser_library::context;
 
 bool location_counter::has_unresolved_spaces() const { return !!org_data_.back().fist_space(); }
 
+bool location_counter::has_any_unresolved_spaces() const
+{
+    auto unresolved = [](const location_counter_data& data) { return !data.unknown_parts.empty(); };
+    return std::any_of(org_data_.begin(), org_data_.end(), unresolved)
+        || std::any_of(switched_org_data_.begin(), switched_org_data_.end(), unresolved);
+}
+
 size_t location_counter::storage() const { return curr_data().storage; }
 
 location_counter::location_counter(id_index name, const section& owner, const loctr_kind kind, id_storage& ids)
@@ -136,10 +143,7 @@ std::pair<space_ptr, std::vector<address>> location_counter::set_available_value
         for (auto& addr : addr_arr)
         {
             if (addr.spaces.front().first->kind == space_kind::LOCTR_BEGIN)
-            {
-                addr.spaces.front().first->remove_listener(&addr);
-                addr.spaces.erase(addr.spaces.begin());
-            }
+                addr.remove_space(0);
         }
     }
 
@@ -54,6 +54,8 @@ public:
     const loctr_kind kind;
 
     bool has_unresolved_spaces() const;
+    // checks the spaces of all ORGs of the counter, including the switched ones
+    bool has_any_unresolved_spaces() const;
     size_t storage() const;
 
     location_counter(id_index name, const section& owner, const loctr_kind kind, id_storage& ids);
@@ -18,6 +18,7 @@
 #include <stdexcept>
 
 #include "alignment.h"
+#include "memory_estimate.h"
 
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::context;
@@ -231,6 +232,15 @@ void ordinary_assembly_context::finish_module_layout()
     }
 }
 
+bool ordinary_assembly_context::has_unresolved_spaces() const
+{
+    for (const auto& sect : sections_)
+        for (const auto& loctr : sect->location_counters())
+            if (loctr->has_any_unresolved_spaces())
+                return true;
+    return false;
+}
+
 const std::unordered_map<id_index, symbol>& ordinary_assembly_context::get_all_symbols() { return symbols_; }
 
 std::pair<address, space_ptr> ordinary_assembly_context::reserve_storage_area_space(size_t length, alignment align)
@@ -248,4 +258,11 @@ std::pair<address, space_ptr> ordinary_assembly_context::reserve_storage_area_sp
         return std::make_pair(ret_addr, sp);
     }
     return std::make_pair(curr_section_->current_location_counter().reserve_storage_area(length, align).first, nullptr);
-}
\ No newline at end of file
+}
+size_t ordinary_assembly_context::memory_estimate() const
+{
+    size_t size = hash_map_memory(symbols_) + vector_memory(sections_);
+    for (const auto& sect : sections_)
+        size += sizeof(section) + sect->location_counters().size() * sizeof(location_counter);
+    return size;
+}
@@ -102,9 +102,14 @@ public:
 
     // creates layout of every section
     void finish_module_layout();
+    // checks whether any space of the module stays unresolved, addresses containing it are registered in the space
+    bool has_unresolved_spaces() const;
 
     const std::unordered_map<id_index, symbol>& get_all_symbols();
 
+    // estimates memory held by symbols and sections
+    size_t memory_estimate() const;
+
 private:
     void create_private_section();
     std::pair<address, space_ptr> reserve_storage_area_space(size_t length, alignment align);
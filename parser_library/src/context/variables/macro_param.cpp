@@ -63,7 +63,7 @@ const macro_param_data_component* macro_param_base::get_data(const std::vector<s
     return data;
 }
 
-A_t macro_param_base::number(std::vector<size_t> offset) const
+A_t macro_param_base::number(const std::vector<size_t>& offset) const
 {
     const macro_param_data_component* tmp = real_data();
 
@@ -74,7 +74,7 @@ A_t macro_param_base::number(std::vector<size_t> offset) const
     return (A_t)tmp->number;
 }
 
-A_t macro_param_base::count(std::vector<size_t> offset) const
+A_t macro_param_base::count(const std::vector<size_t>& offset) const
 {
     const macro_param_data_component* tmp = real_data();
 
@@ -85,7 +85,7 @@ A_t macro_param_base::count(std::vector<size_t> offset) const
     return (A_t)tmp->get_value().size();
 }
 
-size_t macro_param_base::size(std::vector<size_t> offset) const
+size_t macro_param_base::size(const std::vector<size_t>& offset) const
 {
     const macro_param_data_component* tmp = real_data();
 
@@ -15,9 +15,11 @@
 #ifndef CONTEXT_SET_SYMBOL_H
 #define CONTEXT_SET_SYMBOL_H
 
-#include <map>
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 
+#include "set_symbol_storage.h"
 #include "variable.h"
 
 namespace hlasm_plugin {
@@ -50,6 +52,8 @@ public:
     }
 
     virtual std::vector<size_t> keys() const = 0;
+    // returns at most count assigned indices, the first start of them are skipped
+    virtual std::vector<size_t> keys(size_t start, size_t count) const = 0;
     virtual size_t size() const = 0;
 
 protected:
@@ -61,9 +65,30 @@ template<typename T> class set_symbol : public set_symbol_base
 {
     static_assert(object_traits<T>::type_enum != SET_t_enum::UNDEF_TYPE, "Not a SET variable type.");
 
+public:
+    // SETC values are kept in shared buffers, so they are passed to and from SET_t values without copying
+    using stored_type = std::conditional_t<std::is_same_v<T, C_t>, C_ref, T>;
+
+private:
     // data holding this set_symbol
     // can be scalar or only array of scallars - no other nesting allowed
-    std::map<size_t, T> data;
+    set_symbol_storage<stored_type> data;
+
+    static const T& value_of(const stored_type& value)
+    {
+        if constexpr (std::is_same_v<T, C_t>)
+            return *value;
+        else
+            return value;
+    }
+
+    static const stored_type& default_stored()
+    {
+        if constexpr (std::is_same_v<T, C_t>)
+            return object_traits<C_t>::default_ref();
+        else
+            return object_traits<T>::default_v();
+    }
 
 public:
     set_symbol(id_index name, bool is_scalar, bool is_global)
@@ -72,51 +97,51 @@ public:
 
     // gets value from non scalar set symbol
     // if data at idx is not set or it does not exists, default is returned
-    const T& get_value(size_t idx) const
+    const T& get_value(size_t idx) const { return value_of(get_stored_value(idx)); }
+
+    // gets value from scalar set symbol
+    const T& get_value() const { return value_of(get_stored_value()); }
+
+    // get_value variants returning the stored value, SETC values are returned in their shared buffers
+    const stored_type& get_stored_value(size_t idx) const
     {
         if (is_scalar)
-            return object_traits<T>::default_v();
+            return default_stored();
 
         auto tmp = data.find(idx);
-        if (tmp == data.end())
-            return object_traits<T>::default_v();
-        return tmp->second;
+        return tmp ? *tmp : default_stored();
     }
 
-    // gets value from scalar set symbol
-    const T& get_value() const
+    const stored_type& get_stored_value() const
     {
         if (!is_scalar)
-            return object_traits<T>::default_v();
+            return default_stored();
 
         auto tmp = data.find(0);
-        if (tmp == data.end())
-            return object_traits<T>::default_v();
-        return tmp->second;
+        return tmp ? *tmp : default_stored();
     }
 
     // sets value to scalar set symbol
-    void set_value(T value) { data.insert_or_assign(0, std::move(value)); }
+    void set_value(T value) { set_stored_value(to_stored(std::move(value))); }
 
     // sets value to non scalar set symbol
     // any index can be accessed
-    void set_value(T value, size_t idx)
-    {
-        if (is_scalar)
-            data.insert_or_assign(0, std::move(value));
-        else
-            data.insert_or_assign(idx, std::move(value));
-    }
+    void set_value(T value, size_t idx) { set_stored_value(to_stored(std::move(value)), idx); }
+
+    // set_value variants taking the stored value, SETC buffers are shared rather than copied
+    void set_stored_value(stored_type value) { data.assign(0, std::move(value)); }
+
+    void set_stored_value(stored_type value, size_t idx) { data.assign(is_scalar ? 0 : idx, std::move(value)); }
 
     // N' attribute of the symbol
-    virtual A_t number(std::vector<size_t> offset = {}) const override
+    virtual A_t number(const std::vector<size_t>& offset = {}) const override
     {
         (void)offset;
-        return (A_t)(is_scalar || data.empty() ? 0 : data.rbegin()->first + 1);
+        return (A_t)(is_scalar || data.empty() ? 0 : data.max_index() + 1);
     }
 
     // K' attribute of the symbol
-    virtual A_t count(std::vector<size_t> offset = {}) const override;
+    virtual A_t count(const std::vector<size_t>& offset = {}) const override;
 
     virtual size_t size() const override { return data.size(); };
 
@@ -124,41 +149,51 @@ public:
     {
         std::vector<size_t> keys;
         keys.reserve(data.size());
-        for (auto& [key, value] : data)
-            keys.push_back(key);
+        data.for_each_index([&keys](size_t key) { keys.push_back(key); });
         return keys;
     }
 
-private:
-    const T* get_data(std::vector<size_t> offset = {}) const
+    virtual std::vector<size_t> keys(size_t start, size_t count) const override
     {
-        if ((is_scalar && !offset.empty()) || (!is_scalar && offset.size() != 1))
-            return nullptr;
+        std::vector<size_t> keys;
+        keys.reserve(std::min(count, data.size()));
+        data.for_each_index(start, count, [&keys](size_t key) { keys.push_back(key); });
+        return keys;
+    }
 
-        auto tmp_offs = is_scalar ? 0 : offset.front() - 1;
+private:
+    static stored_type to_stored(T value)
+    {
+        if constexpr (std::is_same_v<T, C_t>)
+            return make_C_ref(std::move(value));
+        else
+            return value;
+    }
 
-        if (data.find(tmp_offs) == data.end())
+    const stored_type* get_data(const std::vector<size_t>& offset) const
+    {
+        if ((is_scalar && !offset.empty()) || (!is_scalar && offset.size() != 1))
             return nullptr;
 
-        return &data.at(tmp_offs);
+        return data.find(is_scalar ? 0 : offset.front() - 1);
     }
 };
 
 
-template<> inline A_t set_symbol<A_t>::count(std::vector<size_t> offset) const
+template<> inline A_t set_symbol<A_t>::count(const std::vector<size_t>& offset) const
 {
-    auto tmp = get_data(std::move(offset));
+    auto tmp = get_data(offset);
     return tmp ? (A_t)std::to_string(*tmp).size() : (A_t)1;
 }
-template<> inline A_t set_symbol<B_t>::count(std::vector<size_t> offset) const
+template<> inline A_t set_symbol<B_t>::count(const std::vector<size_t>& offset) const
 {
     (void)offset;
     return (A_t)1;
 }
-template<> inline A_t set_symbol<C_t>::count(std::vector<size_t> offset) const
+template<> inline A_t set_symbol<C_t>::count(const std::vector<size_t>& offset) const
 {
-    auto tmp = get_data(std::move(offset));
-    return tmp ? (A_t)tmp->size() : (A_t)0;
+    auto tmp = get_data(offset);
+    return tmp ? (A_t)(*tmp)->size() : (A_t)0;
 }
 
 } // namespace context
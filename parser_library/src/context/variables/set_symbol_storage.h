@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef CONTEXT_SET_SYMBOL_STORAGE_H
+#define CONTEXT_SET_SYMBOL_STORAGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace hlasm_plugin {
+namespace parser_library {
+namespace context {
+
+// storage of set symbol values indexed by zero based subscript
+// values are kept in a dense vector with presence flags while the used indices are compact,
+// when an index far beyond the already used range is assigned, storage switches to a sparse map
+template<typename T> class set_symbol_storage
+{
+    // indices below this limit are always stored densely
+    static constexpr size_t dense_min_limit = 1024;
+    // dense storage may grow up to this multiple of stored elements
+    static constexpr size_t dense_growth_factor = 4;
+
+    // std::vector<bool> does not provide addressable elements
+    std::conditional_t<std::is_same_v<T, bool>, std::deque<T>, std::vector<T>> dense_;
+    std::vector<bool> present_;
+    std::map<size_t, T> sparse_;
+    bool is_sparse_ = false;
+    size_t size_ = 0;
+
+    bool fits_dense(size_t idx) const
+    {
+        return idx < present_.size() || idx < dense_min_limit || idx / dense_growth_factor < size_ + 1;
+    }
+
+    void make_sparse()
+    {
+        for (size_t i = 0; i < present_.size(); ++i)
+            if (present_[i])
+                sparse_.emplace(i, std::move(dense_[i]));
+        dense_.clear();
+        dense_.shrink_to_fit();
+        present_.clear();
+        present_.shrink_to_fit();
+        is_sparse_ = true;
+    }
+
+public:
+    // returns pointer to value at idx or nullptr when not set
+    const T* find(size_t idx) const
+    {
+        if (is_sparse_)
+        {
+            auto it = sparse_.find(idx);
+            return it == sparse_.end() ? nullptr : &it->second;
+        }
+        return idx < present_.size() && present_[idx] ? &dense_[idx] : nullptr;
+    }
+
+    void assign(size_t idx, T value)
+    {
+        if (!is_sparse_ && !fits_dense(idx))
+            make_sparse();
+
+        if (is_sparse_)
+        {
+            if (sparse_.insert_or_assign(idx, std::move(value)).second)
+                ++size_;
+            return;
+        }
+
+        if (idx >= present_.size())
+        {
+            dense_.resize(idx + 1);
+            present_.resize(idx + 1, false);
+        }
+        dense_[idx] = std::move(value);
+        if (!present_[idx])
+        {
+            present_[idx] = true;
+            ++size_;
+        }
+    }
+
+    // number of assigned values
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    // returns highest assigned index, storage must not be empty
+    size_t max_index() const
+    {
+        // values are never removed, so the last dense slot is always present
+        return is_sparse_ ? sparse_.rbegin()->first : present_.size() - 1;
+    }
+
+    // calls f(idx) for at most count assigned indices in ascending order, the first start of them are skipped
+    template<typename F> void for_each_index(size_t start, size_t count, F&& f) const
+    {
+        if (is_sparse_)
+        {
+            auto it = sparse_.begin();
+            std::advance(it, std::min(start, sparse_.size()));
+            for (; it != sparse_.end() && count > 0; ++it, --count)
+                f(it->first);
+            return;
+        }
+        for (size_t i = 0; i < present_.size() && count > 0; ++i)
+        {
+            if (!present_[i])
+                continue;
+            if (start > 0)
+                --start;
+            else
+            {
+                f(i);
+                --count;
+            }
+        }
+    }
+
+    // calls f(idx) for each assigned index in ascending order
+    template<typename F> void for_each_index(F&& f) const
+    {
+        if (is_sparse_)
+        {
+            for (const auto& [key, value] : sparse_)
+                f(key);
+            return;
+        }
+        for (size_t i = 0; i < present_.size(); ++i)
+            if (present_[i])
+                f(i);
+    }
+};
+
+} // namespace context
+} // namespace parser_library
+} // namespace hlasm_plugin
+
+#endif
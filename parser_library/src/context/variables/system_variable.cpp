@@ -40,18 +40,20 @@ const macro_param_data_component* system_variable::get_data(const std::vector<si
     return tmp;
 }
 
-A_t system_variable::number(std::vector<size_t> offset) const
+A_t system_variable::number(const std::vector<size_t>& offset) const
 {
     if (offset.empty())
         return (A_t)data_->number - 1;
-    else
+
+    const macro_param_data_component* tmp = real_data();
+    for (size_t i = 0; i < offset.size(); ++i)
     {
-        ++offset.front();
-        return (A_t)macro_param_base::number(std::move(offset));
+        tmp = tmp->get_ith(offset[i] - (i == 0 ? 0 : 1));
     }
+    return (A_t)tmp->number;
 }
 
-A_t system_variable::count(std::vector<size_t> offset) const
+A_t system_variable::count(const std::vector<size_t>& offset) const
 {
     if (offset.empty())
         return (A_t)data_->get_ith(1)->get_value().size();
@@ -64,7 +66,7 @@ A_t system_variable::count(std::vector<size_t> offset) const
     return tmp->get_value().size();
 }
 
-size_t system_variable::size(std::vector<size_t> offset) const
+size_t system_variable::size(const std::vector<size_t>& offset) const
 {
     const macro_param_data_component* tmp = real_data();
 
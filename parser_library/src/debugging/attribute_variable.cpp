@@ -30,10 +30,12 @@ set_type attribute_variable::type() const { return set_type::UNDEF_TYPE; }
 
 bool attribute_variable::is_scalar() const { return true; }
 
-std::vector<variable_ptr> attribute_variable::values() const { return std::vector<variable_ptr>(); }
+std::vector<variable_ptr> attribute_variable::values(size_t, size_t) const { return std::vector<variable_ptr>(); }
 
 size_t attribute_variable::size() const { return 0; }
 
+bool attribute_variable::is_indexed() const { return false; }
+
 const std::string& attribute_variable::get_string_value() const
 {
     throw std::runtime_error("Function ord_sym_attribute::get_string_value should never be called!");
@@ -14,6 +14,8 @@
 
 #include "debugger.h"
 
+#include <algorithm>
+
 #include "analyzer.h"
 #include "macro_param_variable.h"
 #include "ordinary_symbol_variable.h"
@@ -72,6 +74,8 @@ void debugger::statement(range stmt_range)
     if (stop_on_next_stmt_ || breakpoint_hit || (step_over_ && ctx_->processing_stack().size() <= step_over_depth_))
     {
         variables_.clear();
+        expandable_.clear();
+        pages_.clear();
         stack_frames_.clear();
         scopes_.clear();
         proc_stack_ = ctx_->processing_stack();
@@ -238,25 +242,38 @@ const std::vector<scope>& debugger::scopes(frame_id_t frame_id)
 
 std::vector<variable_ptr> empty_variables;
 
-const std::vector<variable_ptr>& debugger::variables(var_reference_t var_ref)
+const std::vector<variable_ptr>& debugger::variables(var_reference_t var_ref, size_t start, size_t count)
 {
     std::lock_guard<std::mutex> guard(variable_mtx_);
     if (debug_ended_)
         return empty_variables;
-    auto it = variables_.find(var_ref);
-    if (it == variables_.end())
+
+    const std::vector<variable_ptr>* result;
+    if (auto scope = variables_.find(var_ref); scope != variables_.end())
+        result = &scope->second;
+    else if (auto parent = expandable_.find(var_ref); parent != expandable_.end())
+    {
+        size_t size = parent->second->size();
+        start = std::min(start, size);
+        if (count == 0 || count > size - start)
+            count = size - start;
+        result = &pages_.emplace_back(parent->second->values(start, count));
+    }
+    else
         return empty_variables;
-    for (const variable_ptr& var : variables_[var_ref])
+
+    // the children are not enumerated until the variable is expanded
+    for (const variable_ptr& var : *result)
     {
-        if (var->is_scalar())
+        if (var->is_scalar() || var->var_reference != 0)
             continue;
 
-        variables_.emplace(next_var_ref_, var->values());
         var->var_reference = next_var_ref_;
+        expandable_.emplace(next_var_ref_, var.get());
         ++next_var_ref_;
     }
 
-    return variables_[var_ref];
+    return *result;
 }
 
 debugger::~debugger()
@@ -17,6 +17,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <thread>
 
@@ -72,7 +73,9 @@ public:
     // Retrieval of current context.
     const std::vector<stack_frame>& stack_frames();
     const std::vector<scope>& scopes(frame_id_t frame_id);
-    const std::vector<variable_ptr>& variables(var_reference_t var_ref);
+    // Children of a variable are created only for the requested page, count 0 requests all of them.
+    // Variables of scopes are always returned whole.
+    const std::vector<variable_ptr>& variables(var_reference_t var_ref, size_t start = 0, size_t count = 0);
 
     ~debugger();
 
@@ -114,6 +117,10 @@ private:
     std::vector<scope> scopes_;
 
     std::unordered_map<size_t, std::vector<variable_ptr>> variables_;
+    // variables with children, their children are created when the user expands them
+    std::unordered_map<size_t, const variable*> expandable_;
+    // pages of children created since the last stop, references to them stay valid
+    std::deque<std::vector<variable_ptr>> pages_;
     size_t next_var_ref_ = 1;
     context::processing_stack_t proc_stack_;
 
@@ -14,6 +14,7 @@
 
 #include "macro_param_variable.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 
@@ -36,30 +37,24 @@ const std::string& macro_param_variable::get_string_name() const { return *macro
 
 bool macro_param_variable::is_scalar() const { return macro_param_.size(index_) == 0; }
 
-std::vector<variable_ptr> macro_param_variable::values() const
+std::vector<variable_ptr> macro_param_variable::values(size_t start, size_t count) const
 {
     std::vector<std::unique_ptr<variable>> vals;
 
     std::vector<size_t> child_index = index_;
     child_index.push_back(0);
 
-    if (macro_param_.access_system_variable() && child_index.size() == 1)
+    // elements of system variables are numbered from zero, sublists from one
+    size_t first = macro_param_.access_system_variable() && child_index.size() == 1 ? 0 : 1;
+    size_t end = std::min(size(), start + count);
+    for (size_t i = start; i < end; ++i)
     {
-        for (size_t i = 0; i < size(); ++i)
-        {
-            child_index.back() = i;
-            vals.push_back(std::make_unique<macro_param_variable>(macro_param_, child_index));
-        }
-    }
-    else
-    {
-        for (size_t i = 1; i <= size(); ++i)
-        {
-            child_index.back() = i;
-            vals.push_back(std::make_unique<macro_param_variable>(macro_param_, child_index));
-        }
+        child_index.back() = first + i;
+        vals.push_back(std::make_unique<macro_param_variable>(macro_param_, child_index));
     }
     return vals;
 }
 
 size_t macro_param_variable::size() const { return macro_param_.size(index_); }
+
+bool macro_param_variable::is_indexed() const { return true; }
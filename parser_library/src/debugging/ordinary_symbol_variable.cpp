@@ -66,7 +66,7 @@ bool ordinary_symbol_variable::is_scalar() const
         || symbol_.attributes().is_defined(context::data_attr_kind::T));
 }
 
-std::vector<variable_ptr> ordinary_symbol_variable::values() const
+std::vector<variable_ptr> ordinary_symbol_variable::values(size_t start, size_t count) const
 {
     std::vector<std::unique_ptr<variable>> vars;
     if (symbol_.attributes().is_defined(context::data_attr_kind::L))
@@ -83,6 +83,12 @@ std::vector<variable_ptr> ordinary_symbol_variable::values() const
             ebcdic_encoding::to_ascii(
                 (unsigned char)symbol_.attributes().get_attribute_value(context::data_attr_kind::T))));
 
+    // there are at most four attributes, the page is cut from all of them
+    if (start >= vars.size())
+        return {};
+    vars.erase(vars.begin(), vars.begin() + start);
+    if (count < vars.size())
+        vars.resize(count);
     return vars;
 }
 
@@ -93,3 +99,5 @@ size_t ordinary_symbol_variable::size() const
         + (symbol_.attributes().is_defined(context::data_attr_kind::S) ? 1 : 0)
         + (symbol_.attributes().is_defined(context::data_attr_kind::T) ? 1 : 0);
 }
+
+bool ordinary_symbol_variable::is_indexed() const { return false; }
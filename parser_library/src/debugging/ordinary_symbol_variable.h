@@ -32,8 +32,9 @@ public:
 
     virtual bool is_scalar() const override;
 
-    virtual std::vector<variable_ptr> values() const override;
+    virtual std::vector<variable_ptr> values(size_t start, size_t count) const override;
     virtual size_t size() const override;
+    virtual bool is_indexed() const override;
 
 protected:
     virtual const std::string& get_string_value() const override;
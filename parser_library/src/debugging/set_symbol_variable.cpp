@@ -61,11 +61,11 @@ bool set_symbol_variable::is_scalar() const
         return set_symbol_.is_scalar;
 }
 
-std::vector<variable_ptr> set_symbol_variable::values() const
+std::vector<variable_ptr> set_symbol_variable::values(size_t start, size_t count) const
 {
     std::vector<std::unique_ptr<debugging::variable>> vals;
 
-    auto keys = set_symbol_.keys();
+    auto keys = set_symbol_.keys(start, count);
     for (size_t i = 0; i < keys.size(); ++i)
         vals.push_back(std::make_unique<set_symbol_variable>(set_symbol_, (int)keys[i]));
 
@@ -74,6 +74,8 @@ std::vector<variable_ptr> set_symbol_variable::values() const
 
 size_t set_symbol_variable::size() const { return set_symbol_.size(); }
 
+bool set_symbol_variable::is_indexed() const { return true; }
+
 template<typename T> inline const T& set_symbol_variable::get_value() const
 {
     if (set_symbol_.is_scalar)
@@ -38,8 +38,11 @@ public:
 
     virtual bool is_scalar() const = 0;
 
-    virtual std::vector<variable_ptr> values() const = 0;
+    // Creates count children of the variable starting with the child at index start.
+    virtual std::vector<variable_ptr> values(size_t start, size_t count) const = 0;
     virtual size_t size() const = 0;
+    // Returns true if the children are elements of an array rather than named fields.
+    virtual bool is_indexed() const = 0;
 
     var_reference_t var_reference = 0;
 
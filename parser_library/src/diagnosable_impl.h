@@ -32,20 +32,27 @@ protected:
     virtual void collect_diags_from_child(const collectable<T>& child) const
     {
         child.collect_diags();
+        collect_own_diags_from_child(child);
+    }
+
+    // Moves or copies the diagnostics the child currently holds, without calling its collect_diags
+    virtual void collect_own_diags_from_child(const collectable<T>& child) const
+    {
+        auto& target = diags();
         if (child.is_once_only())
         {
-            container.insert(container.end(),
+            target.insert(target.end(),
                 std::make_move_iterator(child.diags().begin()),
                 std::make_move_iterator(child.diags().end()));
             child.diags().clear();
         }
         else
         {
-            container.insert(container.end(), child.diags().begin(), child.diags().end());
+            target.insert(target.end(), child.diags().begin(), child.diags().end());
         }
     }
 
-    virtual void add_diagnostic(T diagnostic) const override { container.push_back(std::move(diagnostic)); }
+    virtual void add_diagnostic(T diagnostic) const override { diags().push_back(std::move(diagnostic)); }
 
     virtual bool is_once_only() const override { return true; }
 
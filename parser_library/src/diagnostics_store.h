@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_DIAGNOSTICS_STORE_H
+#define HLASMPLUGIN_PARSERLIBRARY_DIAGNOSTICS_STORE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "diagnostic.h"
+#include "protocol.h"
+
+namespace hlasm_plugin::parser_library {
+
+// Shared handle to diagnostics owned by one object of the diagnosable tree.
+// The owner replaces the whole container instead of modifying it, so a handle stays valid.
+using diagnostic_handle = std::shared_ptr<std::vector<diagnostic_s>>;
+
+// Generation-stamped store of diagnostics owned by individual files.
+// An entry is refreshed only when the generation of its owner changes,
+// so the diagnostics of unchanged files are neither collected nor copied.
+class diagnostics_store
+{
+    struct entry
+    {
+        size_t generation;
+        diagnostic_handle diags;
+        bool visited;
+    };
+
+    std::unordered_map<std::string, entry> entries_;
+    std::vector<diagnostic_list_segment> segments_;
+
+public:
+    // Starts a new update round, entries not updated until end_update are removed.
+    void begin_update()
+    {
+        for (auto& [key, e] : entries_)
+            e.visited = false;
+    }
+
+    // Updates diagnostics of the owner identified by key.
+    // get_handle is called only if the generation differs from the stored one.
+    template<typename F> void update(const std::string& key, size_t generation, F&& get_handle)
+    {
+        auto it = entries_.find(key);
+        if (it == entries_.end())
+            entries_.emplace(key, entry { generation, get_handle(), true });
+        else if (it->second.generation != generation)
+            it->second = entry { generation, get_handle(), true };
+        else
+            it->second.visited = true;
+    }
+
+    // Removes entries that were not updated in this round and returns list viewing
+    // own diagnostics followed by diagnostics of all entries.
+    // The list is valid until the next update round or until own is modified.
+    diagnostic_list end_update(std::vector<diagnostic_s>& own)
+    {
+        segments_.clear();
+        size_t size = 0;
+        auto add_segment = [this, &size](std::vector<diagnostic_s>& diags) {
+            if (diags.empty())
+                return;
+            segments_.push_back({ diags.data(), diags.size(), size });
+            size += diags.size();
+        };
+
+        add_segment(own);
+        for (auto it = entries_.begin(); it != entries_.end();)
+        {
+            if (!it->second.visited)
+            {
+                it = entries_.erase(it);
+                continue;
+            }
+            add_segment(*it->second.diags);
+            ++it;
+        }
+
+        return diagnostic_list(segments_.data(), segments_.size(), size);
+    }
+};
+
+} // namespace hlasm_plugin::parser_library
+
+#endif
@@ -200,10 +200,8 @@ expr_ptr arithmetic_expression::g2arith(const std::string& value, bool dbcs)
     return make_arith(val);
 }
 
-expr_ptr arithmetic_expression::binary_operation(str_ref operation, expr_ref arg2) const
+expr_ptr arithmetic_expression::binary_operation(ca_operator operation, expr_ref arg2) const
 {
-    std::string o = operation;
-    std::transform(o.begin(), o.end(), o.begin(), [](char c) { return static_cast<char>(toupper(c)); });
     int32_t val = 0;
     auto e = arg2->retype<arithmetic_expression>();
     if (e == nullptr)
@@ -218,94 +216,85 @@ expr_ptr arithmetic_expression::binary_operation(str_ref operation, expr_ref arg
     else
         val = e->get_value();
 
-    if (o == "OR")
+    switch (operation)
     {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-        return make_arith(value_ | val);
-    }
+        case ca_operator::OR: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            return make_arith(value_ | val);
+        }
 
-    if (o == "AND")
-    {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-        return make_arith(value_ & val);
-    }
+        case ca_operator::AND: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            return make_arith(value_ & val);
+        }
 
-    if (o == "SLA")
-    {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+        case ca_operator::SLA: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
 
-        uint32_t value = static_cast<uint32_t>(value_);
+            uint32_t value = static_cast<uint32_t>(value_);
 
-        return make_arith(
-            (value & (1 << 31)) | ((value & (static_cast<uint32_t>(numeric_part_mask))) << static_cast<uint32_t>(val)));
-    }
+            return make_arith((value & (1 << 31))
+                | ((value & (static_cast<uint32_t>(numeric_part_mask))) << static_cast<uint32_t>(val)));
+        }
 
-    if (o == "SLL")
-    {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-        uint32_t value = static_cast<uint32_t>(value_);
-        return make_arith(static_cast<uint32_t>(value << static_cast<uint32_t>(val)));
-    }
+        case ca_operator::SLL: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            uint32_t value = static_cast<uint32_t>(value_);
+            return make_arith(static_cast<uint32_t>(value << static_cast<uint32_t>(val)));
+        }
 
-    if (o == "SRA")
-    {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-        uint64_t value = static_cast<uint64_t>(static_cast<int64_t>(value_));
-        if ((63 & val) > 31)
-            return make_arith(static_cast<int32_t>((value & (1 << 31)) >> 31));
-        return make_arith(static_cast<int32_t>(value >> (static_cast<uint64_t>(val) & (63))));
-    }
+        case ca_operator::SRA: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            uint64_t value = static_cast<uint64_t>(static_cast<int64_t>(value_));
+            if ((63 & val) > 31)
+                return make_arith(static_cast<int32_t>((value & (1 << 31)) >> 31));
+            return make_arith(static_cast<int32_t>(value >> (static_cast<uint64_t>(val) & (63))));
+        }
 
-    if (o == "SRL")
-    {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-        return make_arith(static_cast<int32_t>(
-            static_cast<uint64_t>(static_cast<uint32_t>(value_)) >> static_cast<uint64_t>(val & (63))));
-    }
+        case ca_operator::SRL: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            return make_arith(static_cast<int32_t>(
+                static_cast<uint64_t>(static_cast<uint32_t>(value_)) >> static_cast<uint64_t>(val & (63))));
+        }
 
-    if (o == "XOR")
-    {
-        copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-        return make_arith(value_ ^ val);
-    }
+        case ca_operator::XOR: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            return make_arith(value_ ^ val);
+        }
 
-    if (o == "EQ")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(value_ == val);
-    }
+        case ca_operator::EQ: {
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(value_ == val);
+        }
 
-    if (o == "LE")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(value_ <= val);
-    }
+        case ca_operator::LE: {
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(value_ <= val);
+        }
 
-    if (o == "LT")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(value_ < val);
-    }
+        case ca_operator::LT: {
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(value_ < val);
+        }
 
-    if (o == "GE")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(value_ >= val);
-    }
+        case ca_operator::GE: {
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(value_ >= val);
+        }
 
-    if (o == "GT")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(value_ > val);
-    }
+        case ca_operator::GT: {
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(value_ > val);
+        }
 
-    if (o == "NE")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(value_ != val);
-    }
+        case ca_operator::NE: {
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(value_ != val);
+        }
 
-    return default_expr_with_error<arithmetic_expression>(error_messages::ea08());
+        default:
+            return default_expr_with_error<arithmetic_expression>(error_messages::ea08());
+    }
 }
 
 expr_ptr arithmetic_expression::operator+(expression_ref e) const
@@ -390,59 +379,52 @@ expr_ptr arithmetic_expression::operator-() const
 
 int32_t arithmetic_expression::get_numeric_value() const { return value_; }
 
-expr_ptr arithmetic_expression::unary_operation(str_ref o) const
+expr_ptr arithmetic_expression::unary_operation(ca_operator operation) const
 {
-    std::string operation_name = o;
-    std::transform(operation_name.begin(), operation_name.end(), operation_name.begin(), [](char c) {
-        return static_cast<char>(toupper(c));
-    });
-    if (operation_name == "NOT")
+    switch (operation)
     {
-        copy_return_on_error(this, arithmetic_expression);
-        return make_arith(value_ ^ static_cast<uint32_t>(-1));
-    }
+        case ca_operator::NOT: {
+            copy_return_on_error(this, arithmetic_expression);
+            return make_arith(value_ ^ static_cast<uint32_t>(-1));
+        }
 
-    if (operation_name == "A2B")
-    {
-        copy_return_on_error(this, character_expression);
-        return make_char(std::bitset<32>(get_value()).to_string());
-    }
+        case ca_operator::A2B: {
+            copy_return_on_error(this, character_expression);
+            return make_char(std::bitset<32>(get_value()).to_string());
+        }
 
-    if (operation_name == "A2C")
-    {
-        copy_return_on_error(this, character_expression);
-        return make_char(character_expression::num_to_ebcdic(get_value()));
-    }
+        case ca_operator::A2C: {
+            copy_return_on_error(this, character_expression);
+            return make_char(character_expression::num_to_ebcdic(get_value()));
+        }
 
-    if (operation_name == "A2D")
-    {
-        copy_return_on_error(this, character_expression);
-        auto val = std::to_string(get_value());
-        if (val[0] == '-')
-            return make_char(std::move(val));
-        else
-            return make_char("+" + val);
-    }
+        case ca_operator::A2D: {
+            copy_return_on_error(this, character_expression);
+            auto val = std::to_string(get_value());
+            if (val[0] == '-')
+                return make_char(std::move(val));
+            else
+                return make_char("+" + val);
+        }
 
-    if (operation_name == "A2X")
-    {
-        copy_return_on_error(this, character_expression);
-        return make_char(character_expression::num_to_hex(value_));
-    }
+        case ca_operator::A2X: {
+            copy_return_on_error(this, character_expression);
+            return make_char(character_expression::num_to_hex(value_));
+        }
 
-    if (operation_name == "BYTE")
-    {
-        copy_return_on_error(this, character_expression);
-        if (value_ > 255 || value_ < 0)
-            return default_expr_with_error<character_expression>(error_messages::ea11());
-        return make_char(ebcdic_encoding::to_ascii(static_cast<unsigned char>(value_)));
-    }
+        case ca_operator::BYTE: {
+            copy_return_on_error(this, character_expression);
+            if (value_ > 255 || value_ < 0)
+                return default_expr_with_error<character_expression>(error_messages::ea11());
+            return make_char(ebcdic_encoding::to_ascii(static_cast<unsigned char>(value_)));
+        }
 
-    if (operation_name == "SIGNED")
-    {
-        copy_return_on_error(this, character_expression);
-        return make_char(std::to_string(get_value()));
-    }
+        case ca_operator::SIGNED: {
+            copy_return_on_error(this, character_expression);
+            return make_char(std::to_string(get_value()));
+        }
 
-    return default_expr_with_error<arithmetic_expression>(error_messages::ea08());
+        default:
+            return default_expr_with_error<arithmetic_expression>(error_messages::ea08());
+    }
 }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include "ca_operator.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <iterator>
+
+namespace hlasm_plugin::parser_library::expressions {
+
+namespace {
+
+#define X(k) #k,
+constexpr std::string_view operator_names[] = { CA_KEYWORDS CA_FUNCTIONS "" };
+#undef X
+
+struct named_operator
+{
+    std::string_view name;
+    ca_operator op;
+};
+
+bool less_upper(std::string_view l, std::string_view r)
+{
+    return std::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end(), [](unsigned char lc, unsigned char rc) {
+        return std::toupper(lc) < std::toupper(rc);
+    });
+}
+
+// operators sorted by name for case insensitive lookup without allocation
+const auto& sorted_operators()
+{
+    static const auto operators = []() {
+        std::array<named_operator, std::size(operator_names)> result {};
+        for (size_t i = 0; i + 1 < std::size(operator_names); ++i)
+            result[i] = { operator_names[i], (ca_operator)i };
+        // asterisk has its own spelling
+        result.back() = { "*", ca_operator::ASTERISK };
+        std::sort(
+            result.begin(), result.end(), [](const auto& l, const auto& r) { return less_upper(l.name, r.name); });
+        return result;
+    }();
+    return operators;
+}
+
+} // namespace
+
+ca_operator ca_operator_from_name(std::string_view name)
+{
+    const auto& operators = sorted_operators();
+    auto it = std::lower_bound(operators.begin(), operators.end(), name, [](const auto& op, std::string_view n) {
+        return less_upper(op.name, n);
+    });
+    if (it == operators.end() || less_upper(name, it->name))
+        return ca_operator::UNKNOWN;
+    return it->op;
+}
+
+std::string_view ca_operator_name(ca_operator op)
+{
+    if (op == ca_operator::ASTERISK)
+        return "*";
+    return operator_names[(size_t)op];
+}
+
+bool is_ca_keyword(ca_operator op) { return op <= ca_operator::DOUBLE; }
+
+} // namespace hlasm_plugin::parser_library::expressions
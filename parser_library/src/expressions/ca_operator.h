@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_EXPRESSIONS_CA_OPERATOR_H
+#define HLASMPLUGIN_PARSERLIBRARY_EXPRESSIONS_CA_OPERATOR_H
+
+#include <string_view>
+
+namespace hlasm_plugin::parser_library::expressions {
+
+// operators that may stand alone in CA expressions, see keyword_expression
+#define CA_KEYWORDS                                                                                                    \
+    X(AND)                                                                                                             \
+    X(AND_NOT)                                                                                                         \
+    X(OR)                                                                                                              \
+    X(OR_NOT)                                                                                                          \
+    X(XOR)                                                                                                             \
+    X(XOR_NOT)                                                                                                         \
+    X(NOT)                                                                                                             \
+    X(EQ)                                                                                                              \
+    X(NE)                                                                                                              \
+    X(LE)                                                                                                              \
+    X(LT)                                                                                                              \
+    X(GE)                                                                                                              \
+    X(GT)                                                                                                              \
+    X(ASTERISK)                                                                                                        \
+    X(FIND)                                                                                                            \
+    X(INDEX)                                                                                                           \
+    X(SLA)                                                                                                             \
+    X(SLL)                                                                                                             \
+    X(SRA)                                                                                                             \
+    X(SRL)                                                                                                             \
+    X(BYTE)                                                                                                            \
+    X(LOWER)                                                                                                           \
+    X(SIGNED)                                                                                                          \
+    X(UPPER)                                                                                                           \
+    X(DOUBLE)
+
+// built-in functions that are called only with parenthesized arguments
+#define CA_FUNCTIONS                                                                                                   \
+    X(A2B)                                                                                                             \
+    X(A2C)                                                                                                             \
+    X(A2D)                                                                                                             \
+    X(A2X)                                                                                                             \
+    X(B2A)                                                                                                             \
+    X(B2C)                                                                                                             \
+    X(B2D)                                                                                                             \
+    X(B2X)                                                                                                             \
+    X(C2A)                                                                                                             \
+    X(C2B)                                                                                                             \
+    X(C2D)                                                                                                             \
+    X(C2X)                                                                                                             \
+    X(D2A)                                                                                                             \
+    X(D2B)                                                                                                             \
+    X(D2C)                                                                                                             \
+    X(D2X)                                                                                                             \
+    X(DCLEN)                                                                                                           \
+    X(DCVAL)                                                                                                           \
+    X(DEQUOTE)                                                                                                         \
+    X(ESYM)                                                                                                            \
+    X(ISBIN)                                                                                                           \
+    X(ISDEC)                                                                                                           \
+    X(ISHEX)                                                                                                           \
+    X(ISSYM)                                                                                                           \
+    X(SYSATTRA)                                                                                                        \
+    X(SYSATTRP)                                                                                                        \
+    X(X2A)                                                                                                             \
+    X(X2B)                                                                                                             \
+    X(X2C)                                                                                                             \
+    X(X2D)
+
+// operators and built-in functions of CA expressions
+// names are resolved once when the expression is parsed, evaluation dispatches on the enum
+#define X(k) k,
+enum class ca_operator
+{
+    CA_KEYWORDS CA_FUNCTIONS UNKNOWN
+};
+#undef X
+
+// returns operator with the case insensitive name, UNKNOWN if there is none
+ca_operator ca_operator_from_name(std::string_view name);
+// returns upper case name of the operator as written in the source
+std::string_view ca_operator_name(ca_operator op);
+// returns true if the operator may stand alone in CA expressions
+bool is_ca_keyword(ca_operator op);
+
+} // namespace hlasm_plugin::parser_library::expressions
+
+#endif
@@ -42,6 +42,8 @@ char_ptr character_expression::append(const character_expression* arg) const
 
 context::SET_t character_expression::get_set_value() const { return value_; }
 
+context::SET_t character_expression::take_set_value() { return std::move(value_); }
+
 character_expression::character_expression(const character_expression& expr)
     : value_(expr.value_)
 {
@@ -65,70 +67,59 @@ int ebcdic_compare(const std::string& lhs, const std::string& rhs)
     return ebcdic_encoding::to_ebcdic(lhs).compare(ebcdic_encoding::to_ebcdic(rhs));
 }
 
-expr_ptr character_expression::binary_operation(str_ref operation, expr_ref arg2) const
+expr_ptr character_expression::binary_operation(ca_operator operation, expr_ref arg2) const
 {
-    std::string o = operation;
-    // case insensitive
-    std::transform(o.begin(), o.end(), o.begin(), [](char c) { return static_cast<char>(toupper(c)); });
     auto a2 = arg2->retype<character_expression>();
     if (a2 == nullptr)
         return default_expr_with_error<character_expression>(error_messages::ec03());
     auto& b = a2->value_;
 
-    if (o == "EQ")
+    switch (operation)
     {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(ebcdic_compare(value_, b) == 0);
-    }
+        case ca_operator::EQ:
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(ebcdic_compare(value_, b) == 0);
 
-    if (o == "NE")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(ebcdic_compare(value_, b) != 0);
-    }
+        case ca_operator::NE:
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(ebcdic_compare(value_, b) != 0);
 
-    if (o == "LE")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(ebcdic_compare(value_, b) <= 0);
-    }
+        case ca_operator::LE:
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(ebcdic_compare(value_, b) <= 0);
 
-    if (o == "LT")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(ebcdic_compare(value_, b) < 0);
-    }
+        case ca_operator::LT:
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(ebcdic_compare(value_, b) < 0);
 
-    if (o == "GT")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(ebcdic_compare(value_, b) > 0);
-    }
+        case ca_operator::GT:
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(ebcdic_compare(value_, b) > 0);
 
-    if (o == "GE")
-    {
-        copy_return_on_error_binary(arg2.get(), logic_expression);
-        return make_logic(ebcdic_compare(value_, b) >= 0);
-    }
-
-    copy_return_on_error_binary(arg2.get(), arithmetic_expression);
-
-    if (o == "FIND")
-        // indices are 1-based
-        return make_arith(static_cast<int32_t>(value_.find_first_of(b)) + 1);
+        case ca_operator::GE:
+            copy_return_on_error_binary(arg2.get(), logic_expression);
+            return make_logic(ebcdic_compare(value_, b) >= 0);
 
-    if (o == "INDEX")
-    {
-        auto i = value_.find(b);
-        if (i == std::string::npos)
-            // 0 indicates not found
-            return make_arith(0);
-        else
+        case ca_operator::FIND:
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
             // indices are 1-based
-            return make_arith(static_cast<int32_t>(i) + 1);
-    }
+            return make_arith(static_cast<int32_t>(value_.find_first_of(b)) + 1);
+
+        case ca_operator::INDEX: {
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            auto i = value_.find(b);
+            if (i == std::string::npos)
+                // 0 indicates not found
+                return make_arith(0);
+            else
+                // indices are 1-based
+                return make_arith(static_cast<int32_t>(i) + 1);
+        }
 
-    return default_expr_with_error<character_expression>(error_messages::ec05());
+        default:
+            copy_return_on_error_binary(arg2.get(), arithmetic_expression);
+            return default_expr_with_error<character_expression>(error_messages::ec05());
+    }
 }
 
 bool character_expression::isalpha_hlasm(char c)
@@ -136,141 +127,125 @@ bool character_expression::isalpha_hlasm(char c)
     return (isalpha(c) || c == '$' || c == '_' || c == '#' || c == '@');
 }
 
-expr_ptr character_expression::unary_operation(str_ref operation) const
+expr_ptr character_expression::unary_operation(ca_operator operation) const
 {
-    std::string o = operation;
-    // transformation to uppercase for case insensitivity
-    std::transform(o.begin(), o.end(), o.begin(), [](char c) { return static_cast<char>(toupper(c)); });
-
-    // binary string to arithmetic expr
-    if (o == "B2A")
+    switch (operation)
     {
-        copy_return_on_error(this, arithmetic_expression);
-        if (value_.empty())
-            return make_arith(0);
-        return arithmetic_expression::from_string(value_, 2);
-    }
+        // binary string to arithmetic expr
+        case ca_operator::B2A:
+            copy_return_on_error(this, arithmetic_expression);
+            if (value_.empty())
+                return make_arith(0);
+            return arithmetic_expression::from_string(value_, 2);
 
-    // interpret string as arith value
-    if (o == "C2A")
-    {
-        copy_return_on_error(this, arithmetic_expression);
-        if (value_.empty())
-            return make_arith(0);
-        return arithmetic_expression::c2arith(value_);
-    }
+        // interpret string as arith value
+        case ca_operator::C2A:
+            copy_return_on_error(this, arithmetic_expression);
+            if (value_.empty())
+                return make_arith(0);
+            return arithmetic_expression::c2arith(value_);
 
-    // parse int (base 10)
-    if (o == "D2A")
-    {
-        copy_return_on_error(this, arithmetic_expression);
-        if (value_.empty())
-            return default_expr_with_error<arithmetic_expression>(error_messages::ec04());
-        return arithmetic_expression::from_string(value_, 10);
-    }
+        // parse int (base 10)
+        case ca_operator::D2A:
+            copy_return_on_error(this, arithmetic_expression);
+            if (value_.empty())
+                return default_expr_with_error<arithmetic_expression>(error_messages::ec04());
+            return arithmetic_expression::from_string(value_, 10);
 
-    if (o == "DCLEN")
-        return dclen();
+        case ca_operator::DCLEN:
+            return dclen();
 
-    if (o == "ISBIN")
-        return isbin();
+        case ca_operator::ISBIN:
+            return isbin();
 
-    if (o == "ISDEC")
-        return isdec();
+        case ca_operator::ISDEC:
+            return isdec();
 
-    if (o == "ISHEX")
-        return ishex();
+        case ca_operator::ISHEX:
+            return ishex();
 
-    if (o == "ISSYM")
-        return issym();
+        case ca_operator::ISSYM:
+            return issym();
 
-    // hexadecimal string to int
-    if (o == "X2A")
-    {
-        copy_return_on_error(this, arithmetic_expression);
-        return arithmetic_expression::from_string(value_, 16);
-    }
+        // hexadecimal string to int
+        case ca_operator::X2A:
+            copy_return_on_error(this, arithmetic_expression);
+            return arithmetic_expression::from_string(value_, 16);
 
-    if (o == "B2C")
-        return b2c();
+        case ca_operator::B2C:
+            return b2c();
 
-    if (o == "B2D")
-        return b2d();
+        case ca_operator::B2D:
+            return b2d();
 
-    if (o == "B2X")
-        return b2x();
+        case ca_operator::B2X:
+            return b2x();
 
-    if (o == "C2B")
-        return c2b();
+        case ca_operator::C2B:
+            return c2b();
 
-    if (o == "C2D")
-        return c2d();
+        case ca_operator::C2D:
+            return c2d();
 
-    if (o == "C2X")
-        return c2x();
+        case ca_operator::C2X:
+            return c2x();
 
-    if (o == "D2B")
-        return d2b();
+        case ca_operator::D2B:
+            return d2b();
 
-    if (o == "D2C")
-        return d2c();
+        case ca_operator::D2C:
+            return d2c();
 
-    if (o == "D2X")
-        return d2x();
+        case ca_operator::D2X:
+            return d2x();
 
-    if (o == "DCVAL")
-        return dcval();
+        case ca_operator::DCVAL:
+            return dcval();
 
-    if (o == "DEQUOTE")
-        return dequote();
+        case ca_operator::DEQUOTE:
+            return dequote();
 
-    if (o == "DOUBLE")
-        return double_quote();
+        case ca_operator::DOUBLE:
+            return double_quote();
 
-    if (o == "ESYM")
-    {
-        /*TODO*/
-        return default_expr_with_error<logic_expression>(error_messages::not_implemented());
-    }
+        case ca_operator::ESYM:
+            /*TODO*/
+            return default_expr_with_error<logic_expression>(error_messages::not_implemented());
 
-    if (o == "LOWER")
-    {
-        copy_return_on_error(this, character_expression);
-        std::string rv = value_;
-        std::transform(rv.begin(), rv.end(), rv.begin(), [](char c) { return static_cast<char>(tolower(c)); });
-        return make_char(std::move(rv));
-    }
+        case ca_operator::LOWER: {
+            copy_return_on_error(this, character_expression);
+            std::string rv = value_;
+            std::transform(rv.begin(), rv.end(), rv.begin(), [](char c) { return static_cast<char>(tolower(c)); });
+            return make_char(std::move(rv));
+        }
 
-    if (o == "SYSATTRA")
-    {
-        /*TODO*/
-        return default_expr_with_error<logic_expression>(error_messages::not_implemented());
-    }
+        case ca_operator::SYSATTRA:
+            /*TODO*/
+            return default_expr_with_error<logic_expression>(error_messages::not_implemented());
 
-    if (o == "SYSATTRP")
-    {
-        /*TODO*/
-        return default_expr_with_error<logic_expression>(error_messages::not_implemented());
-    }
+        case ca_operator::SYSATTRP:
+            /*TODO*/
+            return default_expr_with_error<logic_expression>(error_messages::not_implemented());
 
-    if (o == "UPPER")
-    {
-        copy_return_on_error(this, character_expression);
-        std::string rv = value_;
-        std::transform(rv.begin(), rv.end(), rv.begin(), [](char c) { return static_cast<char>(toupper(c)); });
-        return make_char(std::move(rv));
-    }
+        case ca_operator::UPPER: {
+            copy_return_on_error(this, character_expression);
+            std::string rv = value_;
+            std::transform(rv.begin(), rv.end(), rv.begin(), [](char c) { return static_cast<char>(toupper(c)); });
+            return make_char(std::move(rv));
+        }
 
-    if (o == "X2B")
-        return x2b();
+        case ca_operator::X2B:
+            return x2b();
 
-    if (o == "X2C")
-        return x2c();
+        case ca_operator::X2C:
+            return x2c();
 
-    if (o == "X2D")
-        return x2d();
+        case ca_operator::X2D:
+            return x2d();
 
-    return default_expr_with_error<character_expression>(error_messages::ec05());
+        default:
+            return default_expr_with_error<character_expression>(error_messages::ec05());
+    }
 }
 
 // str len
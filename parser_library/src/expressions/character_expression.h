@@ -53,10 +53,11 @@ public:
     char_ptr append(const char_ptr& arg) const;
     char_ptr append(const character_expression* arg) const;
 
-    virtual expr_ptr binary_operation(str_ref operation_name, expr_ref arg2) const override;
-    virtual expr_ptr unary_operation(str_ref operation_name) const override;
+    virtual expr_ptr binary_operation(ca_operator operation, expr_ref arg2) const override;
+    virtual expr_ptr unary_operation(ca_operator operation) const override;
 
     context::SET_t get_set_value() const override;
+    context::SET_t take_set_value() override;
 
     /**
      * special HLASM CA substring
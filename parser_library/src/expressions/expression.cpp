@@ -35,20 +35,20 @@ void expression::copy_diag(const expression* o) { diag = std::make_unique<diagno
 
 void expression::copy_diag(const expression& o) { diag = std::make_unique<diagnostic_op>(*o.diag); }
 
-expr_ptr expression::binary_operation(str_ref, expr_ref) const
+expr_ptr expression::binary_operation(ca_operator, expr_ref) const
 {
     return default_expr_with_error<arithmetic_expression>(error_messages::e001());
 }
 
-expr_ptr expression::unary_operation(str_ref) const
+expr_ptr expression::unary_operation(ca_operator) const
 {
     return default_expr_with_error<arithmetic_expression>(error_messages::e001());
 }
 
 expr_ptr expression::resolve_ord_symbol(str_ref symbol)
 {
-    if (keyword_expression::is_keyword(symbol))
-        return std::make_unique<keyword_expression>(symbol);
+    if (auto op = ca_operator_from_name(symbol); is_ca_keyword(op))
+        return std::make_unique<keyword_expression>(op);
 
     // TODO: resolve identifier
     if (std::all_of(symbol.cbegin(), symbol.cend(), [](char c) { return isdigit(c); }))
@@ -59,6 +59,24 @@ expr_ptr expression::resolve_ord_symbol(str_ref symbol)
     return default_expr_with_error<arithmetic_expression>(error_messages::not_implemented());
 }
 
+namespace {
+// returns the variant of the complex keyword that negates its second operand
+ca_operator negated_operator(ca_operator op)
+{
+    switch (op)
+    {
+        case ca_operator::AND:
+            return ca_operator::AND_NOT;
+        case ca_operator::OR:
+            return ca_operator::OR_NOT;
+        case ca_operator::XOR:
+            return ca_operator::XOR_NOT;
+        default:
+            return ca_operator::UNKNOWN;
+    }
+}
+} // namespace
+
 #define front_keyword(exprs) dynamic_cast<keyword_expression*>(exprs.front().get())
 
 expr_ptr expression::evaluate(std::deque<expr_ptr> exprs)
@@ -85,12 +103,12 @@ expr_ptr expression::evaluate_term(std::deque<expr_ptr>& exprs, uint8_t priority
         auto o = std::move(exprs.front());
         exprs.pop_front();
 
-        std::string keyword(o->get_str_val());
+        auto op = static_cast<keyword_expression*>(o.get())->get_operator();
         if (dynamic_cast<logic_expression*>(a1.get()) && o->is_complex_keyword() && exprs.front()->is_keyword()
-            && exprs.front()->get_str_val() == "NOT")
+            && front_keyword(exprs)->get_operator() == ca_operator::NOT)
         {
             exprs.pop_front();
-            keyword.append(" NOT");
+            op = negated_operator(op);
         }
         /*
         ++operator_count;
@@ -100,7 +118,7 @@ expr_ptr expression::evaluate_term(std::deque<expr_ptr>& exprs, uint8_t priority
                 (error_messages::e001());
         */
         auto a2 = evaluate_term(exprs, priority, operator_count);
-        return a1->binary_operation(keyword, a2);
+        return a1->binary_operation(op, a2);
     }
     return a1;
 }
@@ -129,7 +147,7 @@ expr_ptr expression::evaluate_factor(std::deque<expr_ptr>& exprs, size_t& operat
         auto op = std::move(exprs.front());
         exprs.pop_front();
         auto e = evaluate_factor(exprs, operator_count);
-        return e->unary_operation(op->get_str_val());
+        return e->unary_operation(static_cast<keyword_expression*>(op.get())->get_operator());
     }
 
     return default_expr_with_error<arithmetic_expression>(error_messages::e001());
@@ -177,6 +195,8 @@ expr_ptr expression::operator-() const
 
 context::SET_t expression::get_set_value() const { return context::SET_t(); }
 
+context::SET_t expression::take_set_value() { return get_set_value(); }
+
 int32_t expression::get_numeric_value() const
 {
     auto t = retype<arithmetic_expression>();
@@ -20,6 +20,7 @@
 
 #include "antlr4-runtime.h"
 
+#include "ca_operator.h"
 #include "context/common_types.h"
 #include "diagnosable.h"
 #include "error_messages.h"
@@ -42,8 +43,8 @@ public:
     bool has_error() const { return diag != nullptr; }
     virtual ~expression() = default;
 
-    virtual expr_ptr binary_operation(str_ref operation_name, expr_ref arg2) const;
-    virtual expr_ptr unary_operation(str_ref operation_name) const;
+    virtual expr_ptr binary_operation(ca_operator operation, expr_ref arg2) const;
+    virtual expr_ptr unary_operation(ca_operator operation) const;
 
     static expr_ptr resolve_ord_symbol(str_ref symbol);
     /**
@@ -65,6 +66,8 @@ public:
     virtual int32_t get_numeric_value() const;
 
     virtual context::SET_t get_set_value() const;
+    // returns the same value as get_set_value, the value may be moved out of the expression
+    virtual context::SET_t take_set_value();
 
     virtual bool is_keyword() const { return false; }
     virtual bool is_complex_keyword() const { return false; }
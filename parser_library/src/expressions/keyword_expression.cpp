@@ -14,7 +14,6 @@
 
 #include "keyword_expression.h"
 
-#include <algorithm>
 #include <stdexcept>
 
 #include "arithmetic_expression.h"
@@ -22,39 +21,26 @@
 
 using namespace hlasm_plugin::parser_library::expressions;
 
-std::map<std::string, keyword_expression::keyword_type, keyword_expression::upper_equal>
-    keyword_expression::keywords_ = {
-#define X(k) { #k, keyword_expression::keyword_type::k },
-        KEYWORDS
-#undef X
-        { "*", keyword_expression::keyword_type::ASTERISK }
-    };
-
-keyword_expression::keyword_expression(str_ref k)
+keyword_expression::keyword_expression(ca_operator k)
+    : value_(k)
 {
-    std::string kw = k;
-    // again, we accept lowercase keywords too
-    std::transform(kw.begin(), kw.end(), kw.begin(), [](char c) { return static_cast<char>(toupper(c)); });
-    auto f = keywords_.find(kw);
-    if (f != keywords_.cend())
-        value_ = f->second;
-    else
+    if (!is_ca_keyword(k))
         throw std::runtime_error("symbol is not a keyword");
-    s_val_ = std::move(kw);
 }
 
 keyword_expression::keyword_expression(const keyword_expression& expr)
-    : s_val_(expr.s_val_)
-    , value_(expr.value_)
+    : value_(expr.value_)
 {
     if (expr.diag)
         diag = std::make_unique<diagnostic_op>(*expr.diag);
 }
 
+ca_operator keyword_expression::get_operator() const { return value_; }
+
 bool keyword_expression::is_unary() const
 {
-    return value_ == keyword_type::NOT || value_ == keyword_type::BYTE || value_ == keyword_type::LOWER
-        || value_ == keyword_type::SIGNED || value_ == keyword_type::UPPER || value_ == keyword_type::DOUBLE;
+    return value_ == ca_operator::NOT || value_ == ca_operator::BYTE || value_ == ca_operator::LOWER
+        || value_ == ca_operator::SIGNED || value_ == ca_operator::UPPER || value_ == ca_operator::DOUBLE;
 }
 
 uint8_t keyword_expression::priority() const
@@ -64,19 +50,19 @@ uint8_t keyword_expression::priority() const
 
     switch (value_)
     {
-        case keyword_type::AND:
-        case keyword_type::AND_NOT:
+        case ca_operator::AND:
+        case ca_operator::AND_NOT:
             return 2;
-        case keyword_type::OR:
-        case keyword_type::OR_NOT:
+        case ca_operator::OR:
+        case ca_operator::OR_NOT:
             return 3;
-        case keyword_type::XOR:
-        case keyword_type::XOR_NOT:
+        case ca_operator::XOR:
+        case ca_operator::XOR_NOT:
             return 4;
-        case keyword_type::SLA:
-        case keyword_type::SLL:
-        case keyword_type::SRA:
-        case keyword_type::SRL:
+        case ca_operator::SLA:
+        case ca_operator::SLL:
+        case ca_operator::SRA:
+        case ca_operator::SRL:
             return 5;
         default:
             return 1;
@@ -87,14 +73,14 @@ bool keyword_expression::is_keyword() const { return true; }
 
 bool keyword_expression::is_complex_keyword() const
 {
-    return value_ == keyword_type::AND || value_ == keyword_type::OR || value_ == keyword_type::XOR;
+    return value_ == ca_operator::AND || value_ == ca_operator::OR || value_ == ca_operator::XOR;
 }
 
-std::string keyword_expression::get_str_val() const { return s_val_; }
+std::string keyword_expression::get_str_val() const { return std::string(ca_operator_name(value_)); }
 
 expr_ptr keyword_expression::to_expression() const
 {
     return default_expr_with_error<arithmetic_expression>(error_messages::not_implemented());
 }
 
-bool keyword_expression::is_keyword(str_ref k) { return keywords_.find(k) != keywords_.cend(); }
+bool keyword_expression::is_keyword(str_ref k) { return is_ca_keyword(ca_operator_from_name(k)); }
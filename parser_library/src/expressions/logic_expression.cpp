@@ -14,8 +14,6 @@
 
 #include "logic_expression.h"
 
-#include <algorithm>
-
 #include "error_messages.h"
 #include "numeric_wrapper.h"
 
@@ -40,15 +38,8 @@ logic_expression::logic_expression(int32_t v)
 
 expr_ptr logic_expression::to_arith() const { return make_arith(static_cast<int32_t>(value_)); }
 
-expr_ptr logic_expression::binary_operation(str_ref o, expr_ref arg2) const
+expr_ptr logic_expression::binary_operation(ca_operator operation, expr_ref arg2) const
 {
-    std::string operation_name = o;
-    // normalize operation name
-    // all text is in HLASM capitalized by default, but we expect lowercase too (for easier work on PC)
-    std::transform(operation_name.begin(), operation_name.end(), operation_name.begin(), [](char c) {
-        return static_cast<char>(toupper(c));
-    });
-
     bool val = false;
     // second operand can be either logical or arithmetic
     auto e = arg2->retype<logic_expression>();
@@ -71,31 +62,27 @@ expr_ptr logic_expression::binary_operation(str_ref o, expr_ref arg2) const
      * standard logical operations
      * */
 
-    if (operation_name == "EQ")
-        return make_logic(value_ == val);
-
-    if (operation_name == "NE")
-        return make_logic(value_ != val);
-
-    if (operation_name == "OR")
-        return make_logic(value_ || val);
-
-    if (operation_name == "OR NOT")
-        return make_logic(value_ || !val);
-
-    if (operation_name == "AND")
-        return make_logic(value_ && val);
-
-    if (operation_name == "AND NOT")
-        return make_logic(value_ && !val);
-
-    if (operation_name == "XOR")
-        return make_logic(value_ ^ val);
-
-    if (operation_name == "XOR NOT")
-        return make_logic(value_ ^ !val);
-
-    return default_expr_with_error<logic_expression>(error_messages::el02());
+    switch (operation)
+    {
+        case ca_operator::EQ:
+            return make_logic(value_ == val);
+        case ca_operator::NE:
+            return make_logic(value_ != val);
+        case ca_operator::OR:
+            return make_logic(value_ || val);
+        case ca_operator::OR_NOT:
+            return make_logic(value_ || !val);
+        case ca_operator::AND:
+            return make_logic(value_ && val);
+        case ca_operator::AND_NOT:
+            return make_logic(value_ && !val);
+        case ca_operator::XOR:
+            return make_logic(value_ ^ val);
+        case ca_operator::XOR_NOT:
+            return make_logic(value_ ^ !val);
+        default:
+            return default_expr_with_error<logic_expression>(error_messages::el02());
+    }
 }
 
 int32_t logic_expression::get_numeric_value() const { return static_cast<int32_t>(value_); }
@@ -207,18 +194,14 @@ expr_ptr logic_expression::operator-() const
     return make_arith(-static_cast<int32_t>(value_));
 }
 
-expr_ptr logic_expression::unary_operation(str_ref o) const
+expr_ptr logic_expression::unary_operation(ca_operator operation) const
 {
-    std::string operation_name = o;
-    std::transform(operation_name.begin(), operation_name.end(), operation_name.begin(), [](char c) {
-        return static_cast<char>(toupper(c));
-    });
-    if (operation_name == "NOT")
+    if (operation == ca_operator::NOT)
     {
         copy_return_on_error(this, logic_expression);
         return make_logic(!value_);
     }
 
     auto ax = to_arith();
-    return ax->unary_operation(operation_name);
+    return ax->unary_operation(operation);
 }
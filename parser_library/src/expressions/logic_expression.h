@@ -51,8 +51,8 @@ public:
      * see: copy_return_on_error and copy_return_on_error_binary
      * */
 
-    expr_ptr unary_operation(str_ref operation_name) const override;
-    expr_ptr binary_operation(str_ref operation_name, expr_ref arg2) const override;
+    expr_ptr unary_operation(ca_operator operation) const override;
+    expr_ptr binary_operation(ca_operator operation, expr_ref arg2) const override;
 
     int32_t get_numeric_value() const override;
 
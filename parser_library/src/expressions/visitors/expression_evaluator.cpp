@@ -203,8 +203,8 @@ antlrcpp::Any expression_evaluator::visitId_sub(parsing::hlasmparser::Id_subCont
     if (subscript.empty())
     {
         auto symbol_name = ctx->id_no_dotContext->name;
-        if (keyword_expression::is_keyword(*symbol_name))
-            return static_cast<expr_ptr>(std::make_unique<keyword_expression>(*symbol_name));
+        if (is_ca_keyword(ctx->op))
+            return static_cast<expr_ptr>(std::make_unique<keyword_expression>(ctx->op));
 
         auto tmp_symbol = eval_ctx_.hlasm_ctx.ord_ctx.get_symbol(symbol_name);
 
@@ -221,9 +221,9 @@ antlrcpp::Any expression_evaluator::visitId_sub(parsing::hlasmparser::Id_subCont
     {
         assert(subscript.size() <= 2 && subscript.size() > 0);
         if (subscript.size() == 1)
-            return subscript[0]->unary_operation(*ctx->id_no_dotContext->name);
+            return subscript[0]->unary_operation(ctx->op);
         else
-            return subscript[0]->binary_operation(*ctx->id_no_dotContext->name, subscript[1]);
+            return subscript[0]->binary_operation(ctx->op, subscript[1]);
     }
 }
 
@@ -262,8 +262,7 @@ antlrcpp::Any expression_evaluator::visitCa_string(parsing::hlasmparser::Ca_stri
 
 antlrcpp::Any expression_evaluator::visitCa_string_b(parsing::hlasmparser::Ca_string_bContext* ctx)
 {
-    auto tmp = concatenate(ctx->string_ch_v_c()->chain);
-    auto ex = make_char(tmp);
+    auto ex = make_char(concatenate(ctx->string_ch_v_c()->chain));
     expr_ptr s, e;
     if (ctx->substring() && ctx->substring()->e1 != nullptr)
         s = visit(ctx->substring()->e1);
@@ -403,7 +402,7 @@ antlrcpp::Any expression_evaluator::visitData_attribute(parsing::hlasmparser::Da
             case context::SET_t_enum::B_TYPE:
                 return static_cast<expr_ptr>(make_logic(SET_val->access_b()));
             case context::SET_t_enum::C_TYPE:
-                return static_cast<expr_ptr>(make_char(SET_val->access_c()));
+                return static_cast<expr_ptr>(make_char(SET_val->take_c()));
             default:
                 break;
         }
@@ -485,7 +484,8 @@ std::string expression_evaluator::concatenate(const semantics::concat_chain& cha
                 break;
             case semantics::concat_type::VAR:
                 last_was_var = true;
-                result.append(concat(point->access_var()));
+                // appended directly from the shared buffer of the value
+                result.append(concat(point->access_var()).access_c());
                 break;
             case semantics::concat_type::SUB:
                 last_was_var = false;
@@ -502,10 +502,10 @@ expr_ptr expression_evaluator::visitE(antlr4::ParserRuleContext* ctx) { return v
 
 std::string expression_evaluator::concat(semantics::char_str* str) { return str->value; }
 
-std::string expression_evaluator::concat(semantics::var_sym* vs)
+context::SET_t expression_evaluator::concat(semantics::var_sym* vs)
 {
     return processing::context_manager(eval_ctx_.hlasm_ctx)
-        .convert_to<context::C_t>(get_var_sym_value(vs), vs->symbol_range);
+        .convert(get_var_sym_value(vs), context::SET_t_enum::C_TYPE, vs->symbol_range);
 }
 
 std::string expression_evaluator::concat(semantics::dot*) { return "."; }
@@ -536,7 +536,7 @@ context::SET_t expression_evaluator::get_var_sym_value(semantics::var_sym* vs)
     else
     {
         auto [valid, name] =
-            mngr.try_get_symbol_name(concatenate(vs->access_created()->created_name), vs->symbol_range);
+            mngr.try_find_symbol_name(concatenate(vs->access_created()->created_name), vs->symbol_range);
         if (!valid)
             return context::SET_t();
         id = name;
@@ -560,7 +560,7 @@ std::pair<context::id_index, std::vector<expr_ptr>> expression_evaluator::evalua
 
     context::id_index name;
     if (vs->created)
-        name = eval_ctx_.hlasm_ctx.ids().add(concatenate_chain(vs->access_created()->created_name));
+        name = eval_ctx_.hlasm_ctx.ids().find(concatenate_chain(vs->access_created()->created_name));
     else
         name = vs->access_basic()->name;
 
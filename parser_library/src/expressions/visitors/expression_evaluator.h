@@ -87,7 +87,7 @@ private:
         context::data_attr_kind attr, const context::symbol* symbol, context::id_index symbol_name, range symbol_range);
 
     std::string concat(semantics::char_str* str);
-    std::string concat(semantics::var_sym* vs);
+    context::SET_t concat(semantics::var_sym* vs);
     std::string concat(semantics::dot*);
     std::string concat(semantics::equals*);
     std::string concat(semantics::sublist* sublist);
@@ -20,6 +20,8 @@
 #include <string>
 #include <utility>
 
+#include "phase_timer.h"
+
 using namespace antlr4;
 using namespace std;
 
@@ -290,6 +292,8 @@ or if empty, tries to lex next token from input
 */
 token_ptr lexer::nextToken()
 {
+    phase_timer timer(metrics_, &performance_metrics::lexing_time);
+
     while (true)
     {
         if (!token_queue_.empty())
@@ -341,6 +345,28 @@ void lexer::delete_token(ssize_t index)
     token_queue_ = {};
 }
 
+void lexer::shift_token_indices(size_t count)
+{
+    last_token_id_ -= count;
+
+    for (size_t i = 0; i < token_queue_.size(); ++i)
+    {
+        auto t = std::move(token_queue_.front());
+        token_queue_.pop();
+        static_cast<token&>(*t).set_token_index(t->getTokenIndex() - count);
+        token_queue_.push(std::move(t));
+    }
+
+    std::set<size_t> shifted;
+    for (auto index : tokens_after_continuation_)
+        if (index >= count)
+            shifted.insert(shifted.end(), index - count);
+    tokens_after_continuation_ = std::move(shifted);
+
+    if (last_continuation_ != static_cast<size_t>(-1))
+        last_continuation_ = last_continuation_ >= count ? last_continuation_ - count : 0;
+}
+
 
 void lexer::lex_tokens()
 {
@@ -64,6 +64,9 @@ public:
 
     void delete_token(ssize_t index);
 
+    // decreases indices of not yet consumed tokens after the token stream released count tokens
+    void shift_token_indices(size_t count);
+
     size_t getLine() const override;
 
     size_t getCharPositionInLine() override;
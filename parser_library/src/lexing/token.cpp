@@ -70,6 +70,8 @@ size_t token::getChannel() const { return channel_; }
 
 size_t token::getTokenIndex() const { return token_index_; }
 
+void token::set_token_index(size_t index) { token_index_ = index; }
+
 size_t token::getStartIndex() const { return start_; }
 
 size_t token::getStopIndex() const { return stop_; }
@@ -51,6 +51,8 @@ public:
     size_t getChannel() const override;
 
     size_t getTokenIndex() const override;
+    // used when the token stream releases preceding tokens and its indices shift
+    void set_token_index(size_t index);
 
     size_t getStartIndex() const override;
 
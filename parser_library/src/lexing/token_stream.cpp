@@ -14,6 +14,10 @@
 
 #include "token_stream.h"
 
+#include <algorithm>
+
+#include "memory_estimate.h"
+
 using namespace hlasm_plugin::parser_library::lexing;
 using namespace antlr4;
 
@@ -57,6 +61,44 @@ void token_stream::rewind_input(lexer::stream_position pos, bool insert_EOLLN)
     sync(_p);
 }
 
+token_stream::checkpoint token_stream::get_checkpoint() const { return { _p, enabled_cont_, enabled_hidden_ }; }
+
+void token_stream::restore(const checkpoint& cp)
+{
+    _p = cp.index;
+    enabled_cont_ = cp.enabled_cont;
+    enabled_hidden_ = cp.enabled_hidden;
+}
+
+size_t token_stream::release_consumed(bool retain)
+{
+    // keep at least two tokens, rewind_input inspects the end of the buffer
+    if (_p == 0 || _tokens.size() <= 2)
+        return 0;
+    size_t count = std::min(_p - 1, _tokens.size() - 2);
+    if (count == 0)
+        return 0;
+
+    auto released_end = _tokens.begin() + count;
+    if (retain)
+        retained_.insert(
+            retained_.end(), std::make_move_iterator(_tokens.begin()), std::make_move_iterator(released_end));
+    _tokens.erase(_tokens.begin(), released_end);
+
+    for (auto& t : _tokens)
+        static_cast<token&>(*t).set_token_index(t->getTokenIndex() - count);
+    _p -= count;
+
+    dynamic_cast<lexer&>(*_tokenSource).shift_token_indices(count);
+
+    return count;
+}
+
+size_t token_stream::memory_estimate() const
+{
+    return vector_memory(_tokens) + vector_memory(retained_) + (_tokens.size() + retained_.size()) * sizeof(token);
+}
+
 void token_stream::reset()
 {
     _tokens.clear();
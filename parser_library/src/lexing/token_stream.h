@@ -54,6 +54,25 @@ public:
 
     void rewind_input(lexer::stream_position pos, bool insert_EOLLN);
 
+    // position and token filtering of the stream, restoring it allows to read the same tokens again
+    struct checkpoint
+    {
+        size_t index;
+        bool enabled_cont;
+        bool enabled_hidden;
+    };
+    checkpoint get_checkpoint() const;
+    void restore(const checkpoint& cp);
+
+    // drops consumed tokens from the buffer, only the last consumed token and the tokens ahead are kept
+    // indices of the kept tokens are decreased accordingly
+    // when retain is set, dropped tokens are kept alive as they are still referenced from parse trees
+    // returns number of dropped tokens
+    size_t release_consumed(bool retain);
+
+    // estimates memory held by buffered and retained tokens
+    size_t memory_estimate() const;
+
     virtual void reset() override;
     // prepares this object to append more tokens
     void append();
@@ -73,6 +92,8 @@ protected:
 
 private:
     std::vector<decltype(_tokens)> tokens_;
+    // released tokens still referenced from parse trees
+    decltype(_tokens) retained_;
 };
 
 } // namespace lexing
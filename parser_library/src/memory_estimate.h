@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_MEMORY_ESTIMATE_H
+#define HLASMPLUGIN_PARSERLIBRARY_MEMORY_ESTIMATE_H
+
+#include <string>
+#include <vector>
+
+// Rough estimates of heap memory held by standard containers, used to account memory held by analyzers of files.
+// Allocator overhead is ignored, nodes of node based containers are counted with their links.
+
+namespace hlasm_plugin::parser_library {
+
+// parse trees of one operand with its expressions and ranges
+constexpr size_t bytes_per_operand = 256;
+
+inline size_t string_memory(const std::string& s)
+{
+    // short strings are stored inside the string object
+    return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+}
+
+template<typename T> size_t vector_memory(const std::vector<T>& v) { return v.capacity() * sizeof(T); }
+
+template<typename T> size_t hash_map_memory(const T& map)
+{
+    return map.bucket_count() * sizeof(void*) + map.size() * (sizeof(typename T::value_type) + 2 * sizeof(void*));
+}
+
+template<typename T> size_t tree_memory(const T& tree)
+{
+    return tree.size() * (sizeof(typename T::value_type) + 4 * sizeof(void*));
+}
+
+} // namespace hlasm_plugin::parser_library
+
+#endif
@@ -29,6 +29,11 @@ enum tokens
 // copied from antlr4::DefaultErrorStrategy.
 class error_strategy : public antlr4::DefaultErrorStrategy
 {
+public:
+    // token index of the last error is no longer valid once the token stream released preceding tokens
+    void forget_error_index() { lastErrorIndex = -1; }
+
+private:
     virtual void reportError(antlr4::Parser* recognizer, const antlr4::RecognitionException& e) override
     {
         if (inErrorRecoveryMode(recognizer))
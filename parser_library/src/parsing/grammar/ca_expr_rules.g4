@@ -61,10 +61,11 @@ term returns [vs_ptr* vs_link = nullptr]
 		$vs_link = &$id_sub.vs;
 	};
 
-id_sub returns [vs_ptr vs]
+id_sub returns [vs_ptr vs, ca_operator op = ca_operator::UNKNOWN]
 	: id_no_dot subscript
 	{ 
 		$vs = std::make_unique<basic_var_sym>($id_no_dot.name,std::move($subscript.value),provider.get_range( $id_no_dot.ctx->getStart(),$subscript.ctx->getStop()));
+		$op = ca_operator_from_name(*$id_no_dot.name);
 	};
 
 expr_p_comma_c returns [std::vector<ParserRuleContext*> ext]
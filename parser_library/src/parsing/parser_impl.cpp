@@ -14,6 +14,7 @@
 
 #include "parser_impl.h"
 
+#include <algorithm>
 #include <cctype>
 
 #include "error_strategy.h"
@@ -21,6 +22,7 @@
 #include "hlasmparser.h"
 #include "lexing/token_stream.h"
 #include "parser_error_listener_ctx.h"
+#include "phase_timer.h"
 #include "processing/context_manager.h"
 #include "processing/statement.h"
 
@@ -28,6 +30,40 @@ using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::lexing;
 using namespace hlasm_plugin::parser_library::parsing;
 
+namespace {
+
+bool holds_parse_trees(const semantics::concat_chain& chain);
+
+bool holds_parse_trees(const semantics::var_sym& symbol)
+{
+    return !symbol.subscript.empty() || (symbol.created && holds_parse_trees(symbol.access_created()->created_name));
+}
+
+// checks whether the chain contains subscripts of variable symbols
+bool holds_parse_trees(const semantics::concat_chain& chain)
+{
+    for (const auto& point : chain)
+    {
+        if (!point)
+            continue;
+        if (point->type == semantics::concat_type::VAR && holds_parse_trees(*point->access_var()))
+            return true;
+        if (point->type == semantics::concat_type::SUB)
+            for (const auto& item : point->access_sub()->list)
+                if (holds_parse_trees(item))
+                    return true;
+    }
+    return false;
+}
+
+// statements of lookahead are charged to the lookahead as a whole
+phase_timer::time_field statement_phase(const processing::statement_processor& proc, phase_timer::time_field field)
+{
+    return proc.kind == processing::processing_kind::LOOKAHEAD ? &performance_metrics::lookahead_time : field;
+}
+
+} // namespace
+
 parser_impl::parser_impl(antlr4::TokenStream* input)
     : Parser(input)
     , ctx(nullptr)
@@ -75,6 +111,61 @@ context::source_position parser_impl::statement_end() const
 }
 
 
+template<typename ParseFunc>
+void parser_impl::parse_with_prediction(parser_holder& h, antlr4::ANTLRErrorListener& listener, ParseFunc&& parse)
+{
+    auto& interpreter = *h.parser->getInterpreter<antlr4::atn::ParserATNSimulator>();
+
+    if (h.parser->ctx->options().prediction == prediction_mode::SLL_THEN_LL)
+    {
+        auto checkpoint = h.stream->get_checkpoint();
+        auto diags_size = h.parser->diags().size();
+
+        // errors are neither reported nor recovered from during the SLL attempt
+        interpreter.setPredictionMode(antlr4::atn::PredictionMode::SLL);
+        h.parser->setErrorHandler(std::make_shared<antlr4::BailErrorStrategy>());
+        h.parser->removeErrorListeners();
+        h.parser->defer_statement_ = true;
+        h.parser->statement_deferred_ = false;
+
+        bool succeeded = true;
+        try
+        {
+            parse();
+        }
+        catch (const antlr4::ParseCancellationException&)
+        {
+            succeeded = false;
+        }
+        h.parser->defer_statement_ = false;
+
+        if (succeeded)
+        {
+            ++h.parser->ctx->metrics.sll_statements;
+            if (h.parser->statement_deferred_)
+            {
+                h.parser->statement_deferred_ = false;
+                h.parser->process_statement();
+            }
+            return;
+        }
+
+        // drop everything the failed attempt produced and start over
+        ++h.parser->ctx->metrics.ll_fallback_statements;
+        h.parser->statement_deferred_ = false;
+        h.parser->diags().erase(h.parser->diags().begin() + diags_size, h.parser->diags().end());
+        h.stream->restore(checkpoint);
+        h.parser->_matchedEOF = false;
+        h.parser->collector.prepare_for_next_statement();
+    }
+
+    interpreter.setPredictionMode(antlr4::atn::PredictionMode::LL);
+    h.parser->setErrorHandler(std::make_shared<error_strategy>());
+    h.parser->removeErrorListeners();
+    h.parser->addErrorListener(&listener);
+    parse();
+}
+
 std::pair<semantics::operands_si, semantics::remarks_si> parser_impl::parse_operand_field(
     context::hlasm_context* hlasm_ctx,
     std::string field,
@@ -82,6 +173,8 @@ std::pair<semantics::operands_si, semantics::remarks_si> parser_impl::parse_oper
     semantics::range_provider field_range,
     processing::processing_status status)
 {
+    phase_timer timer(&hlasm_ctx->metrics, &performance_metrics::reparsing_time);
+
     if (!reparser_)
     {
         std::string s;
@@ -109,9 +202,6 @@ std::pair<semantics::operands_si, semantics::remarks_si> parser_impl::parse_oper
     h.stream->append();
 
     h.parser->initialize(hlasm_ctx, field_range, status);
-    h.parser->setErrorHandler(std::make_shared<error_strategy>());
-    h.parser->removeErrorListeners();
-    h.parser->addErrorListener(&listener);
 
     // indicates that the reparse is done to resolve deferred ordinary symbols (and not to substitute)
     if (!after_substitution)
@@ -126,30 +216,32 @@ std::pair<semantics::operands_si, semantics::remarks_si> parser_impl::parse_oper
     h.parser->collector.prepare_for_next_statement();
 
     semantics::op_rem line;
-    auto& [format, opcode] = status;
-    if (format.occurence == processing::operand_occurence::ABSENT
-        || format.form == processing::processing_form::UNKNOWN)
-        h.parser->op_rem_body_noop();
-    else
-    {
-        switch (format.form)
+    parse_with_prediction(h, listener, [&h, &line, &status]() {
+        auto& [format, opcode] = status;
+        if (format.occurence == processing::operand_occurence::ABSENT
+            || format.form == processing::processing_form::UNKNOWN)
+            h.parser->op_rem_body_noop();
+        else
         {
-            case processing::processing_form::MAC:
-                line = std::move(h.parser->op_rem_body_mac_r()->line);
-                break;
-            case processing::processing_form::ASM:
-                line = std::move(h.parser->op_rem_body_asm_r()->line);
-                break;
-            case processing::processing_form::MACH:
-                line = std::move(h.parser->op_rem_body_mach_r()->line);
-                break;
-            case processing::processing_form::DAT:
-                line = std::move(h.parser->op_rem_body_dat_r()->line);
-                break;
-            default:
-                break;
+            switch (format.form)
+            {
+                case processing::processing_form::MAC:
+                    line = std::move(h.parser->op_rem_body_mac_r()->line);
+                    break;
+                case processing::processing_form::ASM:
+                    line = std::move(h.parser->op_rem_body_asm_r()->line);
+                    break;
+                case processing::processing_form::MACH:
+                    line = std::move(h.parser->op_rem_body_mach_r()->line);
+                    break;
+                case processing::processing_form::DAT:
+                    line = std::move(h.parser->op_rem_body_dat_r()->line);
+                    break;
+                default:
+                    break;
+            }
         }
-    }
+    });
 
     collect_diags_from_child(listener);
 
@@ -283,6 +375,17 @@ void parser_impl::parse_macro_operands(semantics::op_rem& line)
 
 void parser_impl::process_instruction()
 {
+    if (collector.has_label())
+    {
+        const auto& label = collector.current_label();
+        if (label.type == semantics::label_si_type::VAR)
+            retain_tokens_ |= holds_parse_trees(*std::get<semantics::vs_ptr>(label.value));
+        else if (label.type == semantics::label_si_type::CONC)
+            retain_tokens_ |= holds_parse_trees(std::get<semantics::concat_chain>(label.value));
+    }
+    if (collector.current_instruction().type == semantics::instruction_si_type::CONC)
+        retain_tokens_ |= holds_parse_trees(std::get<semantics::concat_chain>(collector.current_instruction().value));
+
     ctx->set_source_position(collector.current_instruction().field_range.start);
     proc_status = processor->get_processing_status(collector.peek_instruction());
 }
@@ -291,6 +394,11 @@ void parser_impl::process_statement()
 {
     if (parent_)
     {
+        if (defer_statement_)
+        {
+            statement_deferred_ = true;
+            return;
+        }
         parent_->collector.append_operand_field(std::move(collector));
         parent_->process_statement();
         return;
@@ -326,6 +434,7 @@ void parser_impl::process_statement()
     lsp_proc->process_hl_symbols(collector.extract_hl_symbols());
     collector.prepare_for_next_statement();
 
+    phase_timer timer(&ctx->metrics, statement_phase(*processor, &performance_metrics::processing_time));
     processor->process_statement(std::move(ptr));
 }
 
@@ -334,12 +443,14 @@ void parser_impl::process_statement(semantics::op_rem line, range op_range)
     collector.set_operand_remark_field(std::move(line.operands), std::move(line.remarks), op_range);
     collector.add_operands_hl_symbols();
     collector.add_remarks_hl_symbols();
-    parent_->collector.append_operand_field(std::move(collector));
-    parent_->process_statement();
+    process_statement();
 }
 
 void parser_impl::process_next(processing::statement_processor& proc)
 {
+    phase_timer timer(&ctx->metrics, statement_phase(proc, &performance_metrics::parsing_time));
+    ++process_depth_;
+
     if (collector.has_instruction())
     {
         // lookahead of attribute ref during instruction processing
@@ -366,6 +477,26 @@ void parser_impl::process_next(processing::statement_processor& proc)
     processor = nullptr;
     collector.prepare_for_next_statement();
     proc_status.reset();
+
+    // nested calls (lookahead during statement processing) leave the release to the outermost one
+    if (--process_depth_ == 0)
+        release_tokens();
+}
+
+void parser_impl::release_tokens()
+{
+    auto& stream = dynamic_cast<token_stream&>(*_input);
+    auto& metrics = ctx->metrics;
+
+    metrics.token_buffer_peak = std::max(metrics.token_buffer_peak, stream.size());
+    auto released = stream.release_consumed(retain_tokens_);
+    if (retain_tokens_)
+        metrics.retained_tokens += released;
+    retain_tokens_ = false;
+
+    if (released)
+        if (auto strategy = std::dynamic_pointer_cast<error_strategy>(getErrorHandler()))
+            strategy->forget_error_index();
 }
 
 bool parser_impl::finished() const { return finished_flag; }
@@ -491,16 +622,14 @@ semantics::operand_list parser_impl::parse_macro_operands(
     h.stream->append();
 
     h.parser->initialize(ctx, tmp_provider, *proc_status);
-    h.parser->setErrorHandler(std::make_shared<error_strategy>());
-    h.parser->removeErrorListeners();
-    h.parser->addErrorListener(&listener);
 
     //	h.parser->reset();
     h.parser->_matchedEOF = false;
 
     h.parser->collector.prepare_for_next_statement();
 
-    auto list = std::move(h.parser->macro_ops()->list);
+    semantics::operand_list list;
+    parse_with_prediction(h, listener, [&h, &list]() { list = std::move(h.parser->macro_ops()->list); });
 
     if (parent_)
         collector.prepare_for_next_statement();
@@ -537,48 +666,47 @@ void parser_impl::parse_rest(std::string text, range text_range)
     h.stream->append();
 
     h.parser->initialize(this);
-    h.parser->setErrorHandler(std::make_shared<error_strategy>());
-    h.parser->removeErrorListeners();
-    h.parser->addErrorListener(&listener);
 
     // h.parser->reset();
     h.parser->_matchedEOF = false;
 
     h.parser->collector.prepare_for_next_statement();
 
-    auto& [format, opcode] = *proc_status;
-    if (format.occurence == processing::operand_occurence::ABSENT
-        || format.form == processing::processing_form::UNKNOWN)
-        h.parser->op_rem_body_noop();
-    else
-    {
-        switch (format.form)
+    parse_with_prediction(h, listener, [&h, this]() {
+        auto& [format, opcode] = *proc_status;
+        if (format.occurence == processing::operand_occurence::ABSENT
+            || format.form == processing::processing_form::UNKNOWN)
+            h.parser->op_rem_body_noop();
+        else
         {
-            case processing::processing_form::IGNORED:
-                h.parser->op_rem_body_ignored();
-                break;
-            case processing::processing_form::DEFERRED:
-                h.parser->op_rem_body_deferred();
-                break;
-            case processing::processing_form::CA:
-                h.parser->op_rem_body_ca();
-                break;
-            case processing::processing_form::MAC:
-                h.parser->op_rem_body_mac();
-                break;
-            case processing::processing_form::ASM:
-                h.parser->op_rem_body_asm();
-                break;
-            case processing::processing_form::MACH:
-                h.parser->op_rem_body_mach();
-                break;
-            case processing::processing_form::DAT:
-                h.parser->op_rem_body_dat();
-                break;
-            default:
-                break;
+            switch (format.form)
+            {
+                case processing::processing_form::IGNORED:
+                    h.parser->op_rem_body_ignored();
+                    break;
+                case processing::processing_form::DEFERRED:
+                    h.parser->op_rem_body_deferred();
+                    break;
+                case processing::processing_form::CA:
+                    h.parser->op_rem_body_ca();
+                    break;
+                case processing::processing_form::MAC:
+                    h.parser->op_rem_body_mac();
+                    break;
+                case processing::processing_form::ASM:
+                    h.parser->op_rem_body_asm();
+                    break;
+                case processing::processing_form::MACH:
+                    h.parser->op_rem_body_mach();
+                    break;
+                case processing::processing_form::DAT:
+                    h.parser->op_rem_body_dat();
+                    break;
+                default:
+                    break;
+            }
         }
-    }
+    });
 
     collect_diags_from_child(listener);
 
@@ -632,16 +760,13 @@ void parser_impl::parse_lookahead(std::string text, range text_range)
     h.stream->append();
 
     h.parser->initialize(this);
-    h.parser->setErrorHandler(std::make_shared<error_strategy>());
-    h.parser->removeErrorListeners();
-    h.parser->addErrorListener(&listener);
 
     // h.parser->append();
     h.parser->_matchedEOF = false;
 
     h.parser->collector.prepare_for_next_statement();
 
-    h.parser->lookahead_operands_and_remarks();
+    parse_with_prediction(h, listener, [&h]() { h.parser->lookahead_operands_and_remarks(); });
 
     listener.diags().clear();
 
@@ -125,6 +125,14 @@ private:
     void parse_rest(std::string text, range text_range);
     void parse_lookahead(std::string text, range text_range);
 
+    // runs parse on the parser of holder h using prediction of the analysis options
+    template<typename ParseFunc>
+    void parse_with_prediction(parser_holder& h, antlr4::ANTLRErrorListener& listener, ParseFunc&& parse);
+
+    // statements are not passed to parent_ until the SLL parse of the operand field succeeds
+    bool defer_statement_ = false;
+    bool statement_deferred_ = false;
+
     virtual antlr4::misc::IntervalSet getExpectedTokens() override;
 
     std::unique_ptr<parser_holder> reparser_;
@@ -132,6 +140,13 @@ private:
 
     bool last_line_processed_;
     bool line_end_pushed_;
+
+    // label and instruction fields of the processed statement hold parse trees referring to its tokens
+    bool retain_tokens_ = false;
+    // number of process_next calls in progress, lookahead may start one while another one processes a statement
+    size_t process_depth_ = 0;
+    // drops tokens of already processed statements from the token stream
+    void release_tokens();
 };
 
 // structure containing parser components
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_PHASE_TIMER_H
+#define HLASMPLUGIN_PARSERLIBRARY_PHASE_TIMER_H
+
+#include <chrono>
+
+#include "protocol.h"
+
+namespace hlasm_plugin::parser_library {
+
+// Scoped timer that adds time spent in a phase of the analysis to a time field of performance_metrics.
+// While a nested timer runs, the enclosing one is paused, so each phase is charged only with its own time.
+// Analysis of a file with all its dependencies runs on one thread, so the innermost timer is tracked per thread.
+// Timer without metrics does not measure anything, its time is charged to the enclosing timer.
+class phase_timer
+{
+public:
+    using time_field = size_t performance_metrics::*;
+
+    phase_timer(performance_metrics* metrics, time_field field)
+        : metrics_(metrics)
+        , field_(field)
+    {
+        if (!metrics_)
+            return;
+
+        auto now = clock::now();
+        parent_ = innermost();
+        if (parent_)
+            parent_->elapsed_ += now - parent_->start_;
+        start_ = now;
+        innermost() = this;
+    }
+
+    phase_timer(const phase_timer&) = delete;
+    phase_timer& operator=(const phase_timer&) = delete;
+
+    ~phase_timer()
+    {
+        if (!metrics_)
+            return;
+
+        auto now = clock::now();
+        elapsed_ += now - start_;
+        metrics_->*field_ += (size_t)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_).count();
+        innermost() = parent_;
+        if (parent_)
+            parent_->start_ = now;
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    static phase_timer*& innermost()
+    {
+        thread_local phase_timer* timer = nullptr;
+        return timer;
+    }
+
+    performance_metrics* metrics_;
+    time_field field_;
+    phase_timer* parent_ = nullptr;
+    clock::time_point start_;
+    clock::duration elapsed_ = clock::duration::zero();
+};
+
+} // namespace hlasm_plugin::parser_library
+
+#endif
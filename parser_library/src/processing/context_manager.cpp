@@ -21,6 +21,19 @@
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::processing;
 
+namespace {
+// returns length of the symbol name at the start of the string, 0 if there is no valid name
+size_t symbol_name_length(const std::string& symbol)
+{
+    size_t i;
+    for (i = 0; i < symbol.size(); ++i)
+        if (!lexing::lexer::ord_char(symbol[i]) || !(i != 0 || !isdigit(symbol[i])))
+            break;
+
+    return i > 63 ? 0 : i;
+}
+} // namespace
+
 context_manager::context_manager(context::hlasm_context& hlasm_ctx)
     : diagnosable_ctx(hlasm_ctx)
     , hlasm_ctx(hlasm_ctx)
@@ -35,7 +48,8 @@ context::SET_t context_manager::evaluate_expression(
 
     collect_diags_from_child(evaluator);
 
-    return result->get_set_value();
+    // the result is not referenced elsewhere, so its string value is moved rather than copied
+    return result.use_count() == 1 ? result->take_set_value() : result->get_set_value();
 }
 
 context::SET_t context_manager::convert(context::SET_t source, context::SET_t_enum target_type, range value_range) const
@@ -84,7 +98,7 @@ context::SET_t context_manager::convert(context::SET_t source, context::SET_t_en
                 case SET_t_enum::B_TYPE:
                     return source.access_b() ? std::string("1") : std::string("0");
                 case SET_t_enum::C_TYPE:
-                    return std::move(source.access_c());
+                    return source;
                 default:
                     break;
             }
@@ -144,8 +158,9 @@ context::macro_data_ptr context_manager::create_macro_data(
 context::SET_t context_manager::get_var_sym_value(
     const semantics::var_sym& symbol, expressions::evaluation_context eval_ctx) const
 {
-    auto id =
-        symbol.created ? concatenate(symbol.access_created()->created_name, eval_ctx) : symbol.access_basic()->name;
+    // generated names are only looked up, a name that is not stored yet cannot name any variable
+    auto id = symbol.created ? hlasm_ctx.ids().find(concatenate_str(symbol.access_created()->created_name, eval_ctx))
+                             : symbol.access_basic()->name;
 
     expressions::expression_evaluator evaluator(eval_ctx);
 
@@ -181,7 +196,7 @@ context::SET_t context_manager::get_var_sym_value(
                     return set_sym->access_set_symbol<context::B_t>()->get_value();
                     break;
                 case context::SET_t_enum::C_TYPE:
-                    return set_sym->access_set_symbol<context::C_t>()->get_value();
+                    return set_sym->access_set_symbol<context::C_t>()->get_stored_value();
                     break;
                 default:
                     return context::SET_t();
@@ -201,7 +216,7 @@ context::SET_t context_manager::get_var_sym_value(
                     return set_sym->access_set_symbol<context::B_t>()->get_value(idx);
                     break;
                 case context::SET_t_enum::C_TYPE:
-                    return set_sym->access_set_symbol<context::C_t>()->get_value(idx);
+                    return set_sym->access_set_symbol<context::C_t>()->get_stored_value(idx);
                     break;
                 default:
                     return context::SET_t();
@@ -233,18 +248,26 @@ context_manager::name_result context_manager::try_get_symbol_name(
 
 context_manager::name_result context_manager::try_get_symbol_name(const std::string& symbol, range symbol_range) const
 {
-    size_t i;
-    for (i = 0; i < symbol.size(); ++i)
-        if (!lexing::lexer::ord_char(symbol[i]) || !(i != 0 || !isdigit(symbol[i])))
-            break;
+    auto length = symbol_name_length(symbol);
+    if (length == 0)
+    {
+        add_diagnostic(diagnostic_op::error_E065(symbol_range));
+        return std::make_pair(false, context::id_storage::empty_id);
+    }
+
+    return std::make_pair(true, hlasm_ctx.ids().add(symbol.substr(0, length)));
+}
 
-    if (i == 0 || i > 63)
+context_manager::name_result context_manager::try_find_symbol_name(const std::string& symbol, range symbol_range) const
+{
+    auto length = symbol_name_length(symbol);
+    if (length == 0)
     {
         add_diagnostic(diagnostic_op::error_E065(symbol_range));
         return std::make_pair(false, context::id_storage::empty_id);
     }
 
-    return std::make_pair(true, hlasm_ctx.ids().add(symbol.substr(0, i)));
+    return std::make_pair(true, hlasm_ctx.ids().find(symbol.substr(0, length)));
 }
 
 bool context_manager::test_symbol_for_read(
@@ -60,7 +60,7 @@ public:
         if constexpr (std::is_same_v<T, context::B_t>)
             return tmp.access_b();
         if constexpr (std::is_same_v<T, context::C_t>)
-            return std::move(tmp.access_c());
+            return tmp.take_c();
     }
 
     context::SET_t get_var_sym_value(const semantics::var_sym& symbol, expressions::evaluation_context eval_ctx) const;
@@ -69,6 +69,8 @@ public:
 
     name_result try_get_symbol_name(const semantics::var_sym* symbol, expressions::evaluation_context eval_ctx) const;
     name_result try_get_symbol_name(const std::string& symbol, range symbol_range) const;
+    // validates the name like try_get_symbol_name but does not store it, the identifier is nullptr for unknown names
+    name_result try_find_symbol_name(const std::string& symbol, range symbol_range) const;
 
     context::id_index concatenate(const semantics::concat_chain& chain, expressions::evaluation_context eval_ctx) const;
     std::string concatenate_str(const semantics::concat_chain& chain, expressions::evaluation_context eval_ctx) const;
@@ -18,6 +18,7 @@
 #include "data_def_postponed_statement.h"
 #include "ebcdic_encoding.h"
 #include "expressions/mach_expr_term.h"
+#include "phase_timer.h"
 #include "postponed_statement_impl.h"
 #include "processing/context_manager.h"
 
@@ -530,6 +531,8 @@ void asm_processor::process_copy(const semantics::complete_statement& stmt,
 
     if (tmp == hlasm_ctx.copy_members().end())
     {
+        hlasm_ctx.metrics.library_lookups++;
+        phase_timer timer(&hlasm_ctx.metrics, &performance_metrics::library_time);
         bool result = lib_provider.parse_library(
             *sym_expr->value, hlasm_ctx, library_data { processing_kind::COPY, sym_expr->value });
 
@@ -14,6 +14,7 @@
 
 #include "ca_processor.h"
 
+#include "phase_timer.h"
 #include "semantics/range_provider.h"
 
 using namespace hlasm_plugin::parser_library;
@@ -31,9 +32,17 @@ ca_processor::ca_processor(context::hlasm_context& hlasm_ctx,
     , listener_(listener)
 {}
 
-void ca_processor::process(context::shared_stmt_ptr stmt) { process_(stmt); }
+void ca_processor::process(context::shared_stmt_ptr stmt)
+{
+    phase_timer timer(&hlasm_ctx.metrics, &performance_metrics::ca_evaluation_time);
+    process_(stmt);
+}
 
-void ca_processor::process(context::unique_stmt_ptr stmt) { process_(std::move(stmt)); }
+void ca_processor::process(context::unique_stmt_ptr stmt)
+{
+    phase_timer timer(&hlasm_ctx.metrics, &performance_metrics::ca_evaluation_time);
+    process_(std::move(stmt));
+}
 
 ca_processor::process_table_t ca_processor::create_table(context::hlasm_context& ctx)
 {
@@ -207,7 +216,7 @@ context::SET_t ca_processor::convert_SET_operand(context::SET_t& value, context:
         return context::SET_t();
     }
 
-    return mngr_.convert(value, type, operand_range);
+    return mngr_.convert(std::move(value), type, operand_range);
 }
 
 bool ca_processor::prepare_GBL_LCL(
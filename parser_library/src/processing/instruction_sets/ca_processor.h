@@ -69,7 +69,8 @@ private:
     bool prepare_SET_operands(
         const semantics::complete_statement& stmt, std::vector<context::SET_t>& values, std::vector<range>& ranges);
     context::SET_t convert_SET_operand(context::SET_t& value, context::SET_t_enum type, range operand_range);
-    template<typename T> T convert_SET_operand_to(context::SET_t& value, range operand_range)
+    // SETC values are returned in their shared buffers
+    template<typename T> auto convert_SET_operand_to(context::SET_t& value, range operand_range)
     {
         auto tmp = convert_SET_operand(value, context::object_traits<T>::type_enum, operand_range);
 
@@ -78,7 +79,7 @@ private:
         if constexpr (std::is_same_v<T, context::B_t>)
             return tmp.access_b();
         if constexpr (std::is_same_v<T, context::C_t>)
-            return std::move(tmp.access_c());
+            return tmp.access_c_ref();
     }
 
     template<typename T> void process_SET(const semantics::complete_statement& stmt)
@@ -102,7 +103,7 @@ private:
             return;
 
         for (size_t i = 0; i < values.size(); i++)
-            set_symbol->access_set_symbol<T>()->set_value(
+            set_symbol->access_set_symbol<T>()->set_stored_value(
                 convert_SET_operand_to<T>(values[i], ranges[i]), index - 1 + i);
     }
 
@@ -17,6 +17,7 @@
 #include <assert.h>
 
 #include "parsing/parser_impl.h"
+#include "phase_timer.h"
 #include "statement_processors/copy_processor.h"
 #include "statement_processors/empty_processor.h"
 #include "statement_processors/lookahead_processor.h"
@@ -40,6 +41,7 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
     , hlasm_ctx_(hlasm_ctx)
     , lib_provider_(lib_provider)
     , opencode_prov_(*base_provider)
+    , releases_scratch_ids_(data.proc_kind == processing_kind::ORDINARY)
     , tracer_(tracer)
 
 {
@@ -115,7 +117,18 @@ void processing_manager::start_processing(std::atomic<bool>* cancel)
         }
 
         update_metrics(proc.kind, prov.kind, hlasm_ctx_.metrics);
+
+        phase_timer timer(&hlasm_ctx_.metrics,
+            proc.kind == processing_kind::LOOKAHEAD ? &performance_metrics::lookahead_time
+                                                    : &performance_metrics::processing_time);
+        // generated names of the processed statement are no longer referenced afterwards
+        // statements suspended by a lookahead may still refer to them
+        bool release_scratch_ids = releases_scratch_ids_ && proc.kind == processing_kind::ORDINARY;
+
         prov.process_next(proc);
+
+        if (release_scratch_ids)
+            hlasm_ctx_.ids().release_scratch();
     }
 }
 
@@ -157,6 +170,7 @@ void processing_manager::finish_macro_definition(macrodef_processing_result resu
 
 void processing_manager::start_lookahead(lookahead_start_data start)
 {
+    hlasm_ctx_.metrics.lookaheads++;
     hlasm_ctx_.push_statement_processing(processing_kind::LOOKAHEAD);
     procs_.emplace_back(
         std::make_unique<lookahead_processor>(hlasm_ctx_, *this, *this, lib_provider_, std::move(start)));
@@ -287,6 +301,9 @@ const attribute_provider::resolved_reference_storage& processing_manager::lookup
     if (all_resolved)
         return resolved_symbols;
 
+    hlasm_ctx_.metrics.lookaheads++;
+    phase_timer timer(&hlasm_ctx_.metrics, &performance_metrics::lookahead_time);
+
     lookahead_processor proc(hlasm_ctx_, *this, *this, lib_provider_, lookahead_start_data(std::move(references)));
 
     context::source_snapshot snapshot = hlasm_ctx_.current_source().create_snapshot();
@@ -61,6 +61,8 @@ private:
     std::vector<provider_ptr> provs_;
 
     opencode_provider& opencode_prov_;
+    // only the processing of the open code releases scratch identifiers, libraries are processed nested in its statements
+    bool releases_scratch_ids_;
 
     statement_provider& find_provider();
     void finish_processor();
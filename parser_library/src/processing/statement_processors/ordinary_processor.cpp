@@ -14,14 +14,64 @@
 
 #include "ordinary_processor.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+
 #include "../statement.h"
 #include "checking/instruction_checker.h"
 #include "ebcdic_encoding.h"
+#include "phase_timer.h"
 
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::processing;
 using namespace hlasm_plugin::parser_library::workspaces;
 
+namespace {
+
+// below this number of statements per thread, the checking is not worth starting a thread
+constexpr size_t min_postponed_statements_per_thread = 1000;
+
+void check_postponed_statement(const context::postponed_statement& stmt,
+    context::hlasm_context& hlasm_ctx,
+    checking::assembler_checker& asm_checker,
+    checking::machine_checker& mach_checker,
+    diagnosable_ctx& diagnoser)
+{
+    assert(stmt.opcode_ref().type == context::instruction_type::ASM
+        || stmt.opcode_ref().type == context::instruction_type::MACH);
+
+    if (stmt.opcode_ref().type == context::instruction_type::ASM)
+        low_language_processor::check(stmt, hlasm_ctx, asm_checker, diagnoser);
+    else
+        low_language_processor::check(stmt, hlasm_ctx, mach_checker, diagnoser);
+}
+
+// diagnostics of the statements checked by one thread
+class postponed_check_buffer : public diagnosable_ctx
+{
+public:
+    postponed_check_buffer(context::hlasm_context& hlasm_ctx)
+        : diagnosable_ctx(hlasm_ctx)
+    {}
+
+    void collect_diags() const override {}
+
+    // range of diagnostics of each checked statement
+    struct statement_diags
+    {
+        size_t statement;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<statement_diags> statements;
+    std::exception_ptr error;
+};
+
+} // namespace
+
 ordinary_processor::ordinary_processor(context::hlasm_context& hlasm_ctx,
     attribute_provider& attr_provider,
     branching_provider& branch_provider,
@@ -51,7 +101,17 @@ processing_status ordinary_processor::get_processing_status(const semantics::ins
 
     if (!status)
     {
-        auto found = eval_ctx.lib_provider.parse_library(*id, hlasm_ctx, library_data { processing_kind::MACRO, id });
+        hlasm_ctx.metrics.library_lookups++;
+        phase_timer timer(&hlasm_ctx.metrics, &performance_metrics::library_time);
+        bool generated = hlasm_ctx.ids().is_scratch(id);
+        // a generated name becomes permanent only when it names a library member
+        if (generated && eval_ctx.lib_provider.has_library(*id, hlasm_ctx))
+        {
+            id = hlasm_ctx.ids().add(*id);
+            generated = false;
+        }
+        auto found = !generated
+            && eval_ctx.lib_provider.parse_library(*id, hlasm_ctx, library_data { processing_kind::MACRO, id });
         processing_form f;
         context::instruction_type t;
         if (found)
@@ -183,6 +243,18 @@ void ordinary_processor::collect_diags() const
 
 void ordinary_processor::check_postponed_statements(std::vector<context::post_stmt_ptr> stmts)
 {
+    phase_timer timer(&hlasm_ctx.metrics, &performance_metrics::postponed_checking_time);
+    hlasm_ctx.metrics.postponed_statements += stmts.size();
+
+    // evaluation of an address with unresolved spaces registers it in the spaces, which the threads would share
+    auto threads =
+        std::min<size_t>(hlasm_ctx.options().checking_threads, stmts.size() / min_postponed_statements_per_thread);
+    if (threads > 1 && !hlasm_ctx.ord_ctx.has_unresolved_spaces())
+    {
+        check_postponed_statements_parallel(stmts, threads);
+        return;
+    }
+
     checking::assembler_checker asm_checker;
     checking::machine_checker mach_checker;
 
@@ -191,13 +263,88 @@ void ordinary_processor::check_postponed_statements(std::vector<context::post_st
         if (!stmt)
             continue;
 
-        assert(stmt->opcode_ref().type == context::instruction_type::ASM
-            || stmt->opcode_ref().type == context::instruction_type::MACH);
+        check_postponed_statement(*stmt, hlasm_ctx, asm_checker, mach_checker, *this);
+    }
+}
 
-        if (stmt->opcode_ref().type == context::instruction_type::ASM)
-            low_language_processor::check(*stmt, hlasm_ctx, asm_checker, *this);
-        else
-            low_language_processor::check(*stmt, hlasm_ctx, mach_checker, *this);
+// with all spaces resolved, the checks only read the symbols and their addresses, but operands of statements generated
+// from one definition are shared and keep the diagnostics of their evaluation, so statements with the same operands are
+// checked by the same thread
+// diagnostics are buffered per thread and merged in the order of the statements
+void ordinary_processor::check_postponed_statements_parallel(
+    const std::vector<context::post_stmt_ptr>& stmts, size_t threads)
+{
+    std::vector<size_t> order;
+    order.reserve(stmts.size());
+    for (size_t i = 0; i < stmts.size(); ++i)
+        if (stmts[i])
+            order.push_back(i);
+
+    auto operands_of = [&stmts](size_t i) -> const void* { return &stmts[i]->operands_ref(); };
+    std::sort(order.begin(), order.end(), [&operands_of](size_t l, size_t r) {
+        return std::less<const void*>()(operands_of(l), operands_of(r))
+            || (operands_of(l) == operands_of(r) && l < r);
+    });
+
+    // groups of statements with the same operands, as ranges in order
+    std::vector<std::pair<size_t, size_t>> groups;
+    for (size_t begin = 0, end = 0; begin < order.size(); begin = end)
+    {
+        end = begin + 1;
+        while (end < order.size() && operands_of(order[end]) == operands_of(order[begin]))
+            ++end;
+        groups.emplace_back(begin, end);
+    }
+
+    std::vector<postponed_check_buffer> buffers(threads, postponed_check_buffer(hlasm_ctx));
+    std::atomic<size_t> next_group = 0;
+
+    auto worker = [&](postponed_check_buffer& buffer) {
+        try
+        {
+            checking::assembler_checker asm_checker;
+            checking::machine_checker mach_checker;
+
+            for (size_t g = next_group++; g < groups.size(); g = next_group++)
+            {
+                for (size_t i = groups[g].first; i < groups[g].second; ++i)
+                {
+                    auto begin = buffer.diags().size();
+                    check_postponed_statement(*stmts[order[i]], hlasm_ctx, asm_checker, mach_checker, buffer);
+                    if (auto end = buffer.diags().size(); end != begin)
+                        buffer.statements.push_back({ order[i], begin, end });
+                }
+            }
+        }
+        catch (...)
+        {
+            buffer.error = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i)
+        workers.emplace_back(worker, std::ref(buffers[i]));
+    worker(buffers[0]);
+    for (auto& t : workers)
+        t.join();
+
+    for (const auto& buffer : buffers)
+        if (buffer.error)
+            std::rethrow_exception(buffer.error);
+
+    std::vector<std::pair<postponed_check_buffer*, const postponed_check_buffer::statement_diags*>> diags_of_statement(
+        stmts.size());
+    for (auto& buffer : buffers)
+        for (const auto& entry : buffer.statements)
+            diags_of_statement[entry.statement] = { &buffer, &entry };
+
+    for (const auto& [buffer, entry] : diags_of_statement)
+    {
+        if (!buffer)
+            continue;
+        for (size_t i = entry->begin; i < entry->end; ++i)
+            add_diagnostic(std::move(buffer->diags()[i]));
     }
 }
 
@@ -256,7 +403,8 @@ context::id_index ordinary_processor::resolve_instruction(
         return context::id_storage::empty_id;
     }
 
-    return hlasm_ctx.ids().add(std::move(tmp));
+    // names of instructions, macros and opsyns are already stored, others are kept only until the statement is processed
+    return hlasm_ctx.ids().add_scratch(std::move(tmp));
 }
 
 void ordinary_processor::collect_ordinary_symbol_definitions()
@@ -274,8 +422,8 @@ void ordinary_processor::collect_ordinary_symbol_definitions()
 
         // add new definition
         auto file = hlasm_ctx.ids().add(ord_symbol->symbol_location.file, true);
-        auto occurences = &hlasm_ctx.lsp_ctx->ord_symbols[context::ord_definition(
-            symbol.name, file, symbol.definition_range, ord_symbol->value(), ord_symbol->attributes())];
+        auto occurences =
+            &hlasm_ctx.lsp_ctx->ord_symbols[context::ord_definition(symbol.name, file, symbol.definition_range)];
         occurences->push_back({ symbol.definition_range, file });
 
         // adds all its occurences
@@ -310,9 +458,7 @@ void ordinary_processor::collect_ordinary_symbol_definitions()
         hlasm_ctx.lsp_ctx
             ->ord_symbols[context::ord_definition(occurence.first.name,
                 hlasm_ctx.ids().add(ord_symbol->symbol_location.file, true),
-                { ord_symbol->symbol_location.pos, ord_symbol->symbol_location.pos },
-                ord_symbol->value(),
-                ord_symbol->attributes())]
+                { ord_symbol->symbol_location.pos, ord_symbol->symbol_location.pos })]
             .push_back({ occurence.first.definition_range, occurence.first.file_name });
     }
     hlasm_ctx.lsp_ctx->deferred_ord_occs = std::move(temp_occs);
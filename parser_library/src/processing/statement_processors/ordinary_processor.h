@@ -67,6 +67,7 @@ public:
 
 private:
     void check_postponed_statements(std::vector<context::post_stmt_ptr> stmts);
+    void check_postponed_statements_parallel(const std::vector<context::post_stmt_ptr>& stmts, size_t threads);
     bool check_fatals(range line_range);
 
     context::id_index resolve_instruction(const semantics::concat_chain& chain, range instruction_range) const;
@@ -24,49 +24,65 @@ common_statement_provider::common_statement_provider(
     , parser(parser)
 {}
 
+namespace {
+// a resolved statement can be reused only when its operation code is known and its identifier is permanent,
+// scratch identifiers are released after each statement and their addresses may be reused by other names
+bool reusable(const processing_status& status, const context::id_storage& ids)
+{
+    return status.first.form != processing_form::UNKNOWN && status.second.type != context::instruction_type::UNDEF
+        && !ids.is_scratch(status.second.value);
+}
+} // namespace
+
 void common_statement_provider::preprocess_deferred(
     statement_processor& processor, context::cached_statement_storage& cache)
 {
     const auto& def_stmt = *cache.get_base()->access_deferred();
 
     auto status = processor.get_processing_status(def_stmt.instruction_ref());
+    bool reuse = reusable(status, hlasm_ctx.ids());
 
     if (status.first.form == processing_form::DEFERRED)
     {
         processor.process_statement(cache.get_base());
     }
-    else if (!cache.contains(status.first.form))
+    else if (auto resolved = reuse ? cache.get_resolved(status.first, status.second) : nullptr)
     {
-        context::cached_statement_storage::cache_entry_t ptr;
-        auto def_impl = std::dynamic_pointer_cast<const semantics::statement_si_deferred>(cache.get_base());
-
-        if (status.first.occurence == operand_occurence::ABSENT || status.first.form == processing_form::UNKNOWN
-            || status.first.form == processing_form::IGNORED)
-        {
-            semantics::operands_si op(def_stmt.deferred_range_ref(), semantics::operand_list());
-            semantics::remarks_si rem(def_stmt.deferred_range_ref(), {});
-
-            ptr = std::make_shared<semantics::statement_si_defer_done>(def_impl, std::move(op), std::move(rem));
-        }
-        else
-        {
-            auto [op, rem] = parser.parse_operand_field(&hlasm_ctx,
-                def_stmt.deferred_ref(),
-                false,
-                semantics::range_provider(def_stmt.deferred_range_ref(), semantics::adjusting_state::NONE),
-                status);
-
-            ptr = std::make_shared<semantics::statement_si_defer_done>(def_impl, std::move(op), std::move(rem));
-        }
-
-        cache.insert(status.first.form, ptr);
-        context::unique_stmt_ptr resolved = std::make_unique<resolved_statement_impl>(ptr, status.second, status.first);
+        // the statement resolves the same way as in the previous expansion
         processor.process_statement(std::move(resolved));
     }
     else
     {
         auto ptr = cache.get(status.first.form);
-        context::unique_stmt_ptr resolved = std::make_unique<resolved_statement_impl>(ptr, status.second, status.first);
-        processor.process_statement(std::move(resolved));
+        if (!ptr)
+        {
+            auto def_impl = std::dynamic_pointer_cast<const semantics::statement_si_deferred>(cache.get_base());
+
+            if (status.first.occurence == operand_occurence::ABSENT || status.first.form == processing_form::UNKNOWN
+                || status.first.form == processing_form::IGNORED)
+            {
+                semantics::operands_si op(def_stmt.deferred_range_ref(), semantics::operand_list());
+                semantics::remarks_si rem(def_stmt.deferred_range_ref(), {});
+
+                ptr = std::make_shared<semantics::statement_si_defer_done>(def_impl, std::move(op), std::move(rem));
+            }
+            else
+            {
+                auto [op, rem] = parser.parse_operand_field(&hlasm_ctx,
+                    def_stmt.deferred_ref(),
+                    false,
+                    semantics::range_provider(def_stmt.deferred_range_ref(), semantics::adjusting_state::NONE),
+                    status);
+
+                ptr = std::make_shared<semantics::statement_si_defer_done>(def_impl, std::move(op), std::move(rem));
+            }
+
+            cache.insert(status.first.form, ptr);
+        }
+
+        auto stmt = std::make_shared<const resolved_statement_impl>(std::move(ptr), status.second, status.first);
+        if (reuse)
+            cache.insert_resolved(stmt);
+        processor.process_statement(std::move(stmt));
     }
 }
@@ -14,6 +14,8 @@
 
 #include "protocol.h"
 
+#include <algorithm>
+
 #include "debugging/debug_types.h"
 #include "diagnosable.h"
 #include "semantics/highlighting_info.h"
@@ -39,6 +41,7 @@ const char* completion_item::documentation()
 }
 bool completion_item::deprecated() { return impl_.deprecated; }
 const char* completion_item::insert_text() { return impl_.insert_text.c_str(); }
+bool completion_item::instruction() { return impl_.instruction; }
 
 completion_list::completion_list(semantics::completion_list_s& info)
     : impl_(info)
@@ -138,14 +141,45 @@ public:
 diagnostic_list::diagnostic_list()
     : begin_(nullptr)
     , size_(0)
+    , segments_(nullptr)
+    , segments_size_(0)
+    , last_segment_(0)
 {}
 
 diagnostic_list::diagnostic_list(diagnostic_s* begin, size_t size)
     : begin_(begin)
     , size_(size)
+    , segments_(nullptr)
+    , segments_size_(0)
+    , last_segment_(0)
+{}
+
+diagnostic_list::diagnostic_list(const diagnostic_list_segment* segments, size_t segments_size, size_t size)
+    : begin_(nullptr)
+    , size_(size)
+    , segments_(segments)
+    , segments_size_(segments_size)
+    , last_segment_(0)
 {}
 
-diagnostic diagnostic_list::diagnostics(size_t index) { return begin_[index]; }
+diagnostic diagnostic_list::diagnostics(size_t index)
+{
+    if (!segments_)
+        return begin_[index];
+
+    const auto* last = segments_ + last_segment_;
+    if (index < last->offset || index >= last->offset + last->size)
+    {
+        // first segment that starts after index, the diagnostic is in the one before it
+        last = std::upper_bound(segments_,
+                   segments_ + segments_size_,
+                   index,
+                   [](size_t i, const diagnostic_list_segment& s) { return i < s.offset; })
+            - 1;
+        last_segment_ = last - segments_;
+    }
+    return last->begin[index - last->offset];
+}
 
 size_t diagnostic_list::diagnostics_size() { return size_; }
 
@@ -216,8 +250,22 @@ const char* variable::value() const { return impl_.get_value().c_str(); }
 
 var_reference_t variable::variable_reference() const { return impl_.var_reference; }
 
+size_t variable::indexed_variables() const { return impl_.is_scalar() || !impl_.is_indexed() ? 0 : impl_.size(); }
+
+size_t variable::named_variables() const { return impl_.is_scalar() || impl_.is_indexed() ? 0 : impl_.size(); }
+
 template<> variable c_view_array<variable, debugging::variable*>::item(size_t index) { return *data_[index]; }
 
+template<> file_memory_usage c_view_array<file_memory_usage, file_memory_usage>::item(size_t index)
+{
+    return data_[index];
+}
+
+template<> workspace_symbol c_view_array<workspace_symbol, workspace_symbol>::item(size_t index)
+{
+    return data_[index];
+}
+
 
 
 } // namespace hlasm_plugin::parser_library
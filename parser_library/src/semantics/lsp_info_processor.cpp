@@ -14,21 +14,68 @@
 
 #include "lsp_info_processor.h"
 
+#include <algorithm>
+#include <optional>
+#include <sstream>
 #include <string_view>
 
 #include "context/instruction.h"
+#include "memory_estimate.h"
+#include "phase_timer.h"
 
 using namespace hlasm_plugin::parser_library;
 using namespace hlasm_plugin::parser_library::semantics;
 using namespace hlasm_plugin::parser_library::context;
 
+namespace {
+bool is_symbol_char(char c) { return std::isalnum((unsigned char)c) || c == '_' || c == '$' || c == '#' || c == '@'; }
+
+bool is_space(char c) { return std::isspace((unsigned char)c) != 0; }
+
+std::string to_upper(std::string s)
+{
+    for (auto& c : s)
+        c = (char)std::toupper((unsigned char)c);
+    return s;
+}
+
+// returns the part of the instruction typed at the end of the line
+// nothing if the line does not end within the instruction field
+std::optional<std::string_view> instruction_prefix(std::string_view line)
+{
+    size_t label_end = 0;
+    if (!line.empty() && !is_space(line.front()))
+    {
+        // comment lines
+        if (line.front() == '*' || (line.size() > 1 && line[1] == '*'))
+            return std::nullopt;
+        while (label_end < line.size() && !is_space(line[label_end]))
+            ++label_end;
+    }
+
+    size_t instr_start = label_end;
+    while (instr_start < line.size() && is_space(line[instr_start]))
+        ++instr_start;
+    // the instruction must be separated from the label
+    if (instr_start == label_end)
+        return std::nullopt;
+
+    auto prefix = line.substr(instr_start);
+    if (std::any_of(prefix.begin(), prefix.end(), is_space))
+        return std::nullopt;
+    // after a label, at least one character of the instruction is required
+    if (label_end > 0 && prefix.empty())
+        return std::nullopt;
+    return prefix;
+}
+} // namespace
+
 lsp_info_processor::lsp_info_processor(
     std::string file, const std::string& text, context::hlasm_context* ctx, bool collect_hl_info)
     : file_name(ctx ? ctx->ids().add(file, true) : nullptr)
     , empty_string(ctx ? ctx->ids().well_known.empty : nullptr)
     , ctx_(ctx)
     , collect_hl_info_(collect_hl_info)
-    , instruction_regex("^([^*][^*]\\S*\\s+\\S+|\\s+\\S*)")
 {
     // initialize text vector
     std::string line;
@@ -95,7 +142,7 @@ lsp_info_processor::lsp_info_processor(
             documentation << "Machine instruction " << std::endl
                           << "Instruction format: "
                           << instruction::mach_format_to_string.at(machine_instr.second->format);
-            ctx_->lsp_ctx->all_instructions.push_back({ machine_instr.first,
+            ctx_->lsp_ctx->add_instruction({ machine_instr.first,
                 "Operands: " + detail.str(),
                 machine_instr.first + "   " + autocomplete.str(),
                 { documentation.str() } });
@@ -112,7 +159,7 @@ lsp_info_processor::lsp_info_processor(
 
             detail << asm_instr.first << "   " << description;
             documentation << "Assembler instruction";
-            ctx_->lsp_ctx->all_instructions.push_back(
+            ctx_->lsp_ctx->add_instruction(
                 { asm_instr.first, detail.str(), asm_instr.first + "   " /*+ description*/, { documentation.str() } });
         }
 
@@ -208,7 +255,7 @@ lsp_info_processor::lsp_info_processor(
                           << "Instruction format: "
                           << instruction::mach_format_to_string.at(
                                  instruction::machine_instructions[instr_name]->format);
-            ctx_->lsp_ctx->all_instructions.push_back({ mnemonic_instr.first,
+            ctx_->lsp_ctx->add_instruction({ mnemonic_instr.first,
                 detail.str(),
                 mnemonic_instr.first + "   " + subs_ops_nomnems.str(),
                 { documentation.str() } });
@@ -216,7 +263,7 @@ lsp_info_processor::lsp_info_processor(
 
         for (const auto& ca_instr : instruction::ca_instructions)
         {
-            ctx_->lsp_ctx->all_instructions.push_back({ ca_instr.name, "", ca_instr.name, { "Conditional Assembly" } });
+            ctx_->lsp_ctx->add_instruction({ ca_instr.name, "", ca_instr.name, { "Conditional Assembly" } });
         }
 
         ctx_->lsp_ctx->initialized = true;
@@ -225,6 +272,8 @@ lsp_info_processor::lsp_info_processor(
 
 void lsp_info_processor::process_hl_symbols(std::vector<token_info> symbols)
 {
+    phase_timer timer(ctx_ ? &ctx_->metrics : nullptr, &performance_metrics::lsp_processing_time);
+
     for (const auto& symbol : symbols)
     {
         add_hl_symbol(symbol);
@@ -236,6 +285,8 @@ void lsp_info_processor::process_lsp_symbols(std::vector<context::lsp_symbol> sy
     if (!ctx_)
         return;
 
+    phase_timer timer(&ctx_->metrics, &performance_metrics::lsp_processing_time);
+
     bool only_ord = false;
     auto symbol_file = file_name;
     // if the file is given, process only ordinary symbols
@@ -302,25 +353,59 @@ bool lsp_info_processor::find_references_(
 completion_list_s lsp_info_processor::completion(const position& pos, const char trigger_char, int trigger_kind) const
 {
     if (!ctx_->lsp_ctx || ctx_->lsp_ctx.use_count() == 0)
-		return { false, {} };
-        
+        return { false, {} };
+
     std::string line_before = (pos.line > 0) ? text_[(unsigned int)pos.line - 1] : "";
     auto line = text_[(unsigned int)pos.line];
     auto line_so_far = line.substr(0, (pos.column == 0) ? 1 : (unsigned int)pos.column);
-    char last_char = (trigger_kind == 1 && line_so_far != "") ? line_so_far.back() : trigger_char;
 
-    if (last_char == '&')
-        return complete_var_(pos);
-    else if (last_char == '.')
-        return complete_seq_(pos);
-    else if ((line_before.size() <= hl_info_.cont_info.continuation_column
-                 || std::isspace(line_before[hl_info_.cont_info.continuation_column]))
-        && std::regex_match(line_so_far, instruction_regex))
-        return { false, ctx_->lsp_ctx->all_instructions };
+    // completion triggered by a character starts a new symbol
+    if (trigger_kind == 2)
+    {
+        if (trigger_char == '&')
+            return complete_symbols_(ctx_->lsp_ctx->var_index, "", pos);
+        else if (trigger_char == '.')
+            return complete_symbols_(ctx_->lsp_ctx->seq_index, "", pos);
+    }
+    else
+    {
+        // the symbol typed so far
+        size_t symbol_start = line_so_far.size();
+        while (symbol_start > 0 && is_symbol_char(line_so_far[symbol_start - 1]))
+            --symbol_start;
+        auto prefix = to_upper(line_so_far.substr(symbol_start));
+
+        if (symbol_start > 0 && line_so_far[symbol_start - 1] == '&')
+            return complete_symbols_(ctx_->lsp_ctx->var_index, prefix, pos);
+        else if (symbol_start > 0 && line_so_far[symbol_start - 1] == '.')
+            return complete_symbols_(ctx_->lsp_ctx->seq_index, prefix, pos);
+    }
+
+    if (line_before.size() <= hl_info_.cont_info.continuation_column
+        || std::isspace(line_before[hl_info_.cont_info.continuation_column]))
+    {
+        if (auto prefix = instruction_prefix(line_so_far))
+            return complete_instruction_(to_upper(std::string(*prefix)));
+    }
 
     return { false, {} };
 }
 
+context::completion_item_s lsp_info_processor::resolve_completion(const std::string& label) const
+{
+    context::completion_item_s result(label, "", label, std::vector<std::string> {});
+    if (!ctx_ || !ctx_->lsp_ctx)
+        return result;
+
+    // symbols have no documentation, only instructions are resolved
+    if (auto instr = ctx_->lsp_ctx->find_instruction(label))
+    {
+        result = *instr;
+        result.implode_contents();
+    }
+    return result;
+}
+
 position_uri_s lsp_info_processor::go_to_definition(const position& pos) const
 {
     position_uri_s result;
@@ -385,6 +470,19 @@ void lsp_info_processor::add_hl_symbol(token_info symbol)
 
 semantics::highlighting_info& lsp_info_processor::get_hl_info() { return hl_info_; }
 
+size_t lsp_info_processor::memory_estimate() const
+{
+    size_t size = vector_memory(text_) + vector_memory(deferred_vars_);
+    for (const auto& line : text_)
+        size += string_memory(line);
+    return size;
+}
+
+size_t lsp_info_processor::highlighting_memory() const
+{
+    return vector_memory(hl_info_.lines) + vector_memory(hl_info_.cont_info.continuation_positions);
+}
+
 bool lsp_info_processor::is_in_range_(const position& pos, const occurence& occ) const
 {
     // check for multi line
@@ -433,7 +531,7 @@ bool lsp_info_processor::get_text_(
         {
             if (is_in_range_(pos, occ))
             {
-                found = symbol.first.get_value();
+                found = hover_text_(symbol.first);
                 return true;
             }
         }
@@ -441,6 +539,16 @@ bool lsp_info_processor::get_text_(
     return false;
 }
 
+std::vector<std::string> lsp_info_processor::hover_text_(const context::ord_definition& symbol) const
+{
+    return symbol.get_value(ctx_->ord_ctx.get_symbol(symbol.name));
+}
+
+std::vector<std::string> lsp_info_processor::hover_text_(const context::instr_definition& symbol) const
+{
+    return symbol.get_value(*ctx_->lsp_ctx);
+}
+
 void lsp_info_processor::process_ord_sym_(const context::ord_definition& symbol)
 {
     if (deferred_instruction_.name == ctx_->ids().well_known.COPY)
@@ -613,7 +721,7 @@ void lsp_info_processor::process_instruction_sym_()
         }
 
         // add it to list of completion items
-        ctx_->lsp_ctx->all_instructions.push_back({ *deferred_instruction_.name,
+        auto item = ctx_->lsp_ctx->add_instruction({ *deferred_instruction_.name,
             params_text.str(),
             trim_instr + "   " + params_text.str(),
             content_pos((unsigned int)deferred_instruction_.definition_range.start.line, &text_) });
@@ -622,7 +730,7 @@ void lsp_info_processor::process_instruction_sym_()
         auto occurences = &ctx_->lsp_ctx->instructions[context::instr_definition(deferred_instruction_.name,
             deferred_instruction_.file_name,
             deferred_instruction_.definition_range,
-            ctx_->lsp_ctx->all_instructions.back(),
+            item,
             current_version)];
         occurences->push_back({ deferred_instruction_.definition_range, deferred_instruction_.file_name });
         if (ctx_->lsp_ctx->deferred_macro_statement.name == deferred_instruction_.name)
@@ -647,18 +755,15 @@ void lsp_info_processor::process_instruction_sym_()
         // define new instruction
         else
         {
-            auto instr = std::find_if(ctx_->lsp_ctx->all_instructions.begin(),
-                ctx_->lsp_ctx->all_instructions.end(),
-                [&](const context::completion_item_s& instr) {
-                    return deferred_instruction_.name && instr.label == *deferred_instruction_.name;
-                });
-            if (instr != ctx_->lsp_ctx->all_instructions.end())
+            auto item = deferred_instruction_.name ? ctx_->lsp_ctx->find_instruction_item(*deferred_instruction_.name)
+                                                   : instr_definition::no_item;
+            if (item != instr_definition::no_item)
             {
                 ctx_->lsp_ctx
                     ->instructions[context::instr_definition(deferred_instruction_.name,
                         deferred_instruction_.file_name,
                         deferred_instruction_.definition_range,
-                        *instr,
+                        item,
                         (size_t)-1)]
                     .push_back({ deferred_instruction_.definition_range, deferred_instruction_.file_name });
             }
@@ -672,34 +777,54 @@ void lsp_info_processor::process_instruction_sym_()
     }
 }
 
-completion_list_s lsp_info_processor::complete_var_(const position& pos) const
+completion_list_s lsp_info_processor::complete_instruction_(const std::string& prefix) const
 {
-    std::vector<context::completion_item_s> items;
-    for (const auto& symbol : ctx_->lsp_ctx->var_symbols)
+    const auto& instructions = ctx_->lsp_ctx->all_instructions;
+    const auto& index = ctx_->lsp_ctx->instruction_index;
+
+    completion_list_s result(false, {});
+    auto it = std::lower_bound(index.begin(), index.end(), prefix, [&instructions](size_t i, const std::string& p) {
+        return instructions[i].label < p;
+    });
+    for (; it != index.end() && instructions[*it].label.compare(0, prefix.size(), prefix) == 0; ++it)
     {
-        if (symbol.first.definition_range.start.line < pos.line && symbol.first.file_name == file_name)
+        if (result.items.size() == completion_page_size)
         {
-            auto value = symbol.first.get_value();
-            assert(value.size() == 1);
-            items.push_back({ *symbol.first.name, value[0], *symbol.first.name, { "" } });
+            result.is_incomplete = true;
+            break;
         }
+        // the documentation is resolved when the item is selected
+        const auto& instr = instructions[*it];
+        result.items.push_back({ instr.label, instr.detail, instr.insert_text, std::vector<std::string> {} });
+        result.items.back().kind = instr.kind;
+        result.items.back().instruction = true;
     }
-    return { false, items };
+    return result;
 }
 
-completion_list_s lsp_info_processor::complete_seq_(const position& pos) const
+template<typename T>
+completion_list_s lsp_info_processor::complete_symbols_(
+    const std::vector<const T*>& index, const std::string& prefix, const position& pos) const
 {
-    std::vector<context::completion_item_s> items;
-    for (auto& symbol : ctx_->lsp_ctx->seq_symbols)
+    completion_list_s result(false, {});
+    auto it = std::lower_bound(
+        index.begin(), index.end(), prefix, [](const T* def, const std::string& p) { return *def->name < p; });
+    for (; it != index.end() && (*it)->name->compare(0, prefix.size(), prefix) == 0; ++it)
     {
-        if (symbol.first.definition_range.start.line < pos.line && symbol.first.file_name == file_name)
+        const auto& symbol = **it;
+        // only symbols defined above the position in the same file are visible
+        if (symbol.definition_range.start.line >= pos.line || symbol.file_name != file_name)
+            continue;
+        if (result.items.size() == completion_page_size)
         {
-            auto value = symbol.first.get_value();
-            assert(value.size() == 1);
-            items.push_back({ *symbol.first.name, value[0], *symbol.first.name, { "" } });
+            result.is_incomplete = true;
+            break;
         }
+        auto value = symbol.get_value();
+        assert(value.size() == 1);
+        result.items.push_back({ *symbol.name, value[0], *symbol.name, { "" } });
     }
-    return { false, items };
+    return result;
 }
 
 int lsp_info_processor::find_latest_version_(
@@ -16,7 +16,6 @@
 #define LSP_INFO_PROC_INFO
 
 #include <memory>
-#include <regex>
 #include <vector>
 
 #include "context/hlasm_context.h"
@@ -50,6 +49,10 @@ struct completion_list_s
     std::vector<context::completion_item_s> items;
 };
 
+// maximal number of items in a completion list, the list is incomplete when more items match
+// the client asks for a new list as the user types, which narrows the matching items
+constexpr size_t completion_page_size = 100;
+
 // lsp info processor processes lsp symbols from parser into symbol definitions and their occurencies used for responses
 // to lsp requests
 class lsp_info_processor
@@ -72,6 +75,8 @@ public:
     std::vector<position_uri_s> references(const position& pos) const;
     std::vector<std::string> hover(const position& pos) const;
     completion_list_s completion(const position& pos, const char trigger_char, int trigger_kind) const;
+    // returns the instruction completion item with the given label including its documentation
+    context::completion_item_s resolve_completion(const std::string& label) const;
 
     // add one lsp symbol to the context
     void add_lsp_symbol(context::lsp_symbol& symbol);
@@ -80,6 +85,11 @@ public:
 
     semantics::highlighting_info& get_hl_info();
 
+    // estimates memory held by the text of the file and the symbols waiting for more information
+    size_t memory_estimate() const;
+    // estimates memory held by the highlighting information
+    size_t highlighting_memory() const;
+
 private:
     // stored symbols that couldn't be processed without further information
     std::vector<context::var_definition> deferred_vars_;
@@ -92,9 +102,6 @@ private:
     semantics::highlighting_info hl_info_;
     // specifies whether to generate highlighting information
     bool collect_hl_info_;
-    // regex that represents a common position of instruction within a statement
-    const std::regex instruction_regex;
-
 
     // checks whether the given position is within occurence's range
     bool is_in_range_(const position& pos, const context::occurence& occ) const;
@@ -110,6 +117,10 @@ private:
     // within a given set of symbols, checks whether it contains a symbol on a given position and returns its contents
     template<typename T>
     bool get_text_(const position& pos, const context::definitions<T>& symbols, std::vector<std::string>& found) const;
+    // returns the hover text of the symbol, it is generated from the context only when requested
+    std::vector<std::string> hover_text_(const context::ord_definition& symbol) const;
+    std::vector<std::string> hover_text_(const context::instr_definition& symbol) const;
+    template<typename T> std::vector<std::string> hover_text_(const T& symbol) const { return symbol.get_value(); }
     // processes deferred variable symbols
     void process_var_syms_();
     // processes current sequence symbol
@@ -118,10 +129,12 @@ private:
     void process_ord_sym_(const context::ord_definition& symbol);
     // processes deferred instruction symbol
     void process_instruction_sym_();
-    // responds to completion request on variable symbol
-    completion_list_s complete_var_(const position& pos) const;
-    // responds to completion request on sequence symbols
-    completion_list_s complete_seq_(const position& pos) const;
+    // responds to completion request on instructions starting with the prefix
+    completion_list_s complete_instruction_(const std::string& prefix) const;
+    // responds to completion request on variable or sequence symbols starting with the prefix
+    template<typename T>
+    completion_list_s complete_symbols_(
+        const std::vector<const T*>& index, const std::string& prefix, const position& pos) const;
     // finds the latest version of macro
     int find_latest_version_(const context::instr_definition& current,
         const context::definitions<context::instr_definition>& to_check) const;
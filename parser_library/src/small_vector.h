@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_SMALL_VECTOR_H
+#define HLASMPLUGIN_PARSERLIBRARY_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hlasm_plugin::parser_library {
+
+// Vector that stores up to N elements inside the object and allocates only when it grows larger.
+// Iterators and references are invalidated by every insertion and by moving the vector.
+template<typename T, size_t N> class small_vector
+{
+    static_assert(N > 0, "small_vector needs inline capacity");
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    small_vector() = default;
+
+    small_vector(std::initializer_list<T> init)
+    {
+        reserve(init.size());
+        for (const auto& e : init)
+            emplace_back(e);
+    }
+
+    small_vector(const small_vector& other)
+    {
+        reserve(other.size_);
+        std::uninitialized_copy(other.begin(), other.end(), begin());
+        size_ = other.size_;
+    }
+
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) { take(std::move(other)); }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size_);
+            std::uninitialized_copy(other.begin(), other.end(), begin());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            release_heap();
+            take(std::move(other));
+        }
+        return *this;
+    }
+
+    ~small_vector()
+    {
+        clear();
+        release_heap();
+    }
+
+    iterator begin() { return data(); }
+    iterator end() { return data() + size_; }
+    const_iterator begin() const { return data(); }
+    const_iterator end() const { return data() + size_; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    T* data() { return heap_ ? heap_ : inline_data(); }
+    const T* data() const { return heap_ ? heap_ : inline_data(); }
+
+    size_t size() const { return size_; }
+    size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+    // true when the elements are stored outside of the object
+    bool on_heap() const { return heap_ != nullptr; }
+
+    T& operator[](size_t i) { return data()[i]; }
+    const T& operator[](size_t i) const { return data()[i]; }
+    T& front() { return data()[0]; }
+    const T& front() const { return data()[0]; }
+    T& back() { return data()[size_ - 1]; }
+    const T& back() const { return data()[size_ - 1]; }
+
+    void reserve(size_t new_capacity)
+    {
+        if (new_capacity <= capacity_)
+            return;
+
+        auto new_data = std::allocator<T>().allocate(new_capacity);
+        std::uninitialized_move(begin(), end(), new_data);
+        std::destroy(begin(), end());
+        release_heap();
+        heap_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    template<typename... Args> T& emplace_back(Args&&... args)
+    {
+        if (size_ == capacity_)
+            reserve(2 * capacity_);
+        auto e = new (data() + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *e;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back()
+    {
+        --size_;
+        std::destroy_at(data() + size_);
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto f = begin() + (first - begin());
+        auto l = begin() + (last - begin());
+        if (f != l)
+        {
+            auto new_end = std::move(l, end(), f);
+            std::destroy(new_end, end());
+            size_ -= l - f;
+        }
+        return f;
+    }
+
+    void clear()
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    friend bool operator==(const small_vector& l, const small_vector& r)
+    {
+        return std::equal(l.begin(), l.end(), r.begin(), r.end());
+    }
+    friend bool operator!=(const small_vector& l, const small_vector& r) { return !(l == r); }
+
+private:
+    std::aligned_storage_t<sizeof(T), alignof(T)> inline_[N];
+    T* heap_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = N;
+
+    T* inline_data() { return std::launder(reinterpret_cast<T*>(inline_)); }
+    const T* inline_data() const { return std::launder(reinterpret_cast<const T*>(inline_)); }
+
+    void release_heap()
+    {
+        if (!heap_)
+            return;
+        std::allocator<T>().deallocate(heap_, capacity_);
+        heap_ = nullptr;
+        capacity_ = N;
+    }
+
+    // expects this vector to be empty and without heap storage
+    void take(small_vector&& other)
+    {
+        if (other.heap_)
+        {
+            heap_ = std::exchange(other.heap_, nullptr);
+            capacity_ = std::exchange(other.capacity_, N);
+            size_ = std::exchange(other.size_, 0);
+            return;
+        }
+        std::uninitialized_move(other.begin(), other.end(), inline_data());
+        size_ = other.size_;
+        other.clear();
+    }
+};
+
+} // namespace hlasm_plugin::parser_library
+
+#endif
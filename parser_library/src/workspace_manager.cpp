@@ -77,6 +77,12 @@ void workspace_manager::did_change_file(
 
 void workspace_manager::did_close_file(const char* document_uri) { impl_->did_close_file(document_uri); }
 
+void workspace_manager::set_memory_budget(size_t bytes) { impl_->set_memory_budget(bytes); }
+
+void workspace_manager::set_checking_threads(size_t threads) { impl_->set_checking_threads(threads); }
+
+void workspace_manager::set_storage_path(const char* path) { impl_->set_storage_path(path); }
+
 void workspace_manager::register_highlighting_consumer(highlighting_consumer* consumer)
 {
     impl_->register_highlighting_consumer(consumer);
@@ -112,6 +118,17 @@ completion_list workspace_manager::completion(
     return impl_->completion(document_uri, pos, trigger_char, trigger_kind);
 }
 
+completion_item workspace_manager::completion_resolve(const char* document_uri, const char* label)
+{
+    return impl_->completion_resolve(document_uri, label);
+}
+
+workspace_symbols workspace_manager::find_symbols(const char* query) { return impl_->find_symbols(query); }
+
+file_memory_usages workspace_manager::memory_usage() { return impl_->memory_usage(); }
+
+bool workspace_manager::idle_work() { return impl_->idle_work(); }
+
 void workspace_manager::launch(const char* file_name, bool stop_on_entry) { impl_->launch(file_name, stop_on_entry); }
 
 void workspace_manager::next() { impl_->next(); }
@@ -126,9 +143,9 @@ stack_frames workspace_manager::get_stack_frames() { return impl_->get_stack_fra
 
 scopes workspace_manager::get_scopes(frame_id_t frame_id) { return impl_->get_scopes(frame_id); }
 
-variables workspace_manager::get_variables(var_reference_t var_reference)
+variables workspace_manager::get_variables(var_reference_t var_reference, size_t start, size_t count)
 {
-    return impl_->get_variables(var_reference);
+    return impl_->get_variables(var_reference, start, count);
 }
 
 void workspace_manager::set_breakpoints(const char* source_path, breakpoint* breakpoints, size_t br_size)
@@ -15,8 +15,14 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_MANAGER_IMPL_H
 #define HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_MANAGER_IMPL_H
 
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <tuple>
+
 #include "debugging/debug_lib_provider.h"
 #include "debugging/debugger.h"
+#include "diagnostics_store.h"
 #include "workspace_manager.h"
 #include "workspaces/file_manager_impl.h"
 #include "workspaces/workspace.h"
@@ -33,13 +39,22 @@ public:
         : file_manager_(cancel)
         , implicit_workspace_({ file_manager_ })
         , cancel_(cancel)
-    {}
+    {
+        implicit_workspace_.set_background_analysis(true);
+    }
     impl(const impl&) = delete;
     impl& operator=(const impl&) = delete;
 
     impl(impl&&) = delete;
     impl& operator=(impl&&) = delete;
 
+    // closed workspaces save the usage of the library members collected in the session
+    ~impl()
+    {
+        for (auto& [name, ws] : workspaces_)
+            ws.close();
+    }
+
     size_t get_workspaces(ws_id* workspaces, size_t max_size)
     {
         size_t size = 0;
@@ -56,6 +71,10 @@ public:
     void add_workspace(std::string name, std::string uri)
     {
         auto ws = workspaces_.emplace(name, workspaces::workspace(uri, name, file_manager_));
+        ws.first->second.set_background_analysis(true);
+        ws.first->second.set_analyzer_options(analyzer_options_);
+        if (!storage_path_.empty())
+            ws.first->second.set_member_usage_file(member_usage_file(uri));
         ws.first->second.open();
 
         notify_diagnostics_consumers();
@@ -65,21 +84,21 @@ public:
         auto it = workspaces_.find(uri);
         if (it == workspaces_.end())
             return; // erase does no action, if the key does not exist
-        workspaces_.erase(uri);
+        it->second.close();
+        workspaces_.erase(it);
         notify_diagnostics_consumers();
     }
 
     void did_open_file(const std::string& document_uri, version_t version, std::string text)
     {
         file_manager_.did_open_file(document_uri, version, std::move(text));
-        if (cancel_ && *cancel_)
-            return;
-
+        // a preempted analysis is left to the background analysis of the workspace, so it has to know of the file
         workspaces::workspace& ws = ws_path_match(document_uri);
         ws.did_open_file(document_uri);
         if (cancel_ && *cancel_)
             return;
 
+        file_manager_.enforce_memory_budget();
         notify_highlighting_consumers();
         notify_diagnostics_consumers();
         // only on open
@@ -89,14 +108,12 @@ public:
         const std::string document_uri, version_t version, const document_change* changes, size_t ch_size)
     {
         file_manager_.did_change_file(document_uri, version, changes, ch_size);
-        if (cancel_ && *cancel_)
-            return;
-
         workspaces::workspace& ws = ws_path_match(document_uri);
         ws.did_change_file(document_uri, changes, ch_size);
         if (cancel_ && *cancel_)
             return;
 
+        file_manager_.enforce_memory_budget();
         notify_highlighting_consumers();
         notify_diagnostics_consumers();
     }
@@ -105,6 +122,7 @@ public:
     {
         workspaces::workspace& ws = ws_path_match(document_uri);
         ws.did_close_file(document_uri);
+        file_manager_.enforce_memory_budget();
         notify_highlighting_consumers();
         notify_diagnostics_consumers();
     }
@@ -116,10 +134,34 @@ public:
             workspaces::workspace& ws = ws_path_match(path);
             ws.did_change_watched_files(path);
         }
+        file_manager_.enforce_memory_budget();
         notify_highlighting_consumers();
         notify_diagnostics_consumers();
     }
 
+    void set_memory_budget(size_t bytes)
+    {
+        file_manager_.set_memory_budget(bytes);
+        file_manager_.enforce_memory_budget();
+    }
+
+    void set_checking_threads(size_t threads)
+    {
+        analyzer_options_.checking_threads = std::max<size_t>(threads, 1);
+        implicit_workspace_.set_analyzer_options(analyzer_options_);
+        for (auto& [name, ws] : workspaces_)
+            ws.set_analyzer_options(analyzer_options_);
+    }
+
+    void set_storage_path(std::string path)
+    {
+        storage_path_ = std::move(path);
+        if (storage_path_.empty())
+            return;
+        for (auto& [name, ws] : workspaces_)
+            ws.set_member_usage_file(member_usage_file(ws.uri()));
+    }
+
     void register_highlighting_consumer(highlighting_consumer* consumer) { hl_consumers_.push_back(consumer); }
 
     void register_diagnostics_consumer(diagnostics_consumer* consumer) { diag_consumers_.push_back(consumer); }
@@ -136,9 +178,8 @@ public:
         if (cancel_ && *cancel_)
             return found_position;
         
-        auto file = file_manager_.find(document_uri);
-        if (dynamic_cast<workspaces::processor_file*>(file.get()) != nullptr)
-            found_position = file_manager_.find_processor_file(document_uri)->get_lsp_info().go_to_definition(pos);
+        if (auto file = find_resident_processor_file(document_uri))
+            found_position = file->get_lsp_info().go_to_definition(pos);
 
         return found_position;
     }
@@ -150,13 +191,54 @@ public:
         if (cancel_ && *cancel_)
             return { found_refs.data(), found_refs.size() };
 
-        auto file = file_manager_.find(document_uri);
-        if (dynamic_cast<workspaces::processor_file*>(file.get()) != nullptr)
-            found_refs = file_manager_.find_processor_file(document_uri)->get_lsp_info().references(pos);
+        if (auto file = find_resident_processor_file(document_uri))
+        {
+            auto info = file->get_lsp_info();
+            found_refs = info.references(pos);
+
+            // symbols defined in macros and copy members are used by the other programs of the workspace as well
+            auto definition = info.go_to_definition(pos);
+            const auto& index = ws_path_match(document_uri).get_symbol_index();
+            if (auto symbol = index.defined_at(definition.uri, definition.pos))
+            {
+                for (const auto& occ : index.occurrences(*symbol))
+                    found_refs.emplace_back(*occ.file, occ.occurrence_range.start);
+                std::sort(found_refs.begin(), found_refs.end(), [](const auto& l, const auto& r) {
+                    return std::tie(l.uri, l.pos.line, l.pos.column) < std::tie(r.uri, r.pos.line, r.pos.column);
+                });
+                found_refs.erase(std::unique(found_refs.begin(), found_refs.end()), found_refs.end());
+            }
+        }
 
         return { found_refs.data(), found_refs.size() };
     }
 
+    std::vector<workspace_symbol> found_symbols;
+    workspace_symbols find_symbols(const char* query)
+    {
+        found_symbols.clear();
+        if (cancel_ && *cancel_)
+            return { found_symbols.data(), found_symbols.size() };
+
+        // symbols are stored in upper case
+        std::string prefix = query;
+        std::transform(prefix.begin(), prefix.end(), prefix.begin(), [](unsigned char c) { return (char)toupper(c); });
+
+        auto collect = [this, &prefix](const workspaces::workspace& ws) {
+            if (found_symbols.size() >= workspaces::workspace_symbol_limit)
+                return;
+            for (const auto* symbol :
+                ws.get_symbol_index().find(prefix, workspaces::workspace_symbol_limit - found_symbols.size()))
+                found_symbols.emplace_back(
+                    symbol->name.c_str(), symbol->kind, symbol->file.c_str(), symbol->definition_range);
+        };
+        collect(implicit_workspace_);
+        for (const auto& [name, ws] : workspaces_)
+            collect(ws);
+
+        return { found_symbols.data(), found_symbols.size() };
+    }
+
     std::vector<std::string> output;
     std::vector<const char*> coutput;
     const string_array hover(const char* document_uri, const position pos)
@@ -165,9 +247,8 @@ public:
         if (cancel_ && *cancel_)
             return { coutput.data(), coutput.size() };
 
-        auto file = file_manager_.find(document_uri);
-        if (dynamic_cast<workspaces::processor_file*>(file.get()) != nullptr)
-            output = file_manager_.find_processor_file(document_uri)->get_lsp_info().hover(pos);
+        if (auto file = find_resident_processor_file(document_uri))
+            output = file->get_lsp_info().hover(pos);
         else
             output.clear();
         for (const auto& str : output)
@@ -183,15 +264,60 @@ public:
         if (cancel_ && *cancel_)
             return completion_result;
 
-        auto file = file_manager_.find(document_uri);
-        if (dynamic_cast<workspaces::processor_file*>(file.get()) != nullptr)
-            completion_result = file_manager_.find_processor_file(document_uri)
-                                    ->get_lsp_info()
-                                    .completion(pos, trigger_char, trigger_kind);
+        if (auto file = find_resident_processor_file(document_uri))
+            completion_result = file->get_lsp_info().completion(pos, trigger_char, trigger_kind);
 
         return completion_result;
     }
 
+    completion_item completion_resolve(const char* document_uri, const char* label)
+    {
+        resolved_item_ = context::completion_item_s(label, "", label, std::vector<std::string> {});
+        if (cancel_ && *cancel_)
+            return resolved_item_;
+
+        if (auto file = find_resident_processor_file(document_uri))
+            resolved_item_ = file->get_lsp_info().resolve_completion(label);
+
+        return resolved_item_;
+    }
+
+    file_memory_usages memory_usage()
+    {
+        auto files = file_manager_.list_processor_files();
+        memory_usage_uris_.clear();
+        memory_usage_.clear();
+        // the uris are referenced by the result, so they must not be reallocated
+        memory_usage_uris_.reserve(files.size());
+        for (const auto& file : files)
+        {
+            const auto& uri = memory_usage_uris_.emplace_back(file->get_file_name());
+            memory_usage_.emplace_back(uri.c_str(), file->resident(), file->get_memory_usage());
+        }
+        return { memory_usage_.data(), memory_usage_.size() };
+    }
+
+    bool idle_work()
+    {
+        // dependants waiting for their analysis go before the warm-up
+        if (background_analysis_step(implicit_workspace_))
+            return true;
+        for (auto& [name, ws] : workspaces_)
+            if (background_analysis_step(ws))
+                return true;
+
+        // the warm-up of a workspace is finished when its step reports there is nothing left
+        for (auto& [name, ws] : workspaces_)
+            if (ws.warm_up_step(cancel_))
+                return true;
+
+        // the programs that were not opened are indexed last, they are the most expensive
+        for (auto& [name, ws] : workspaces_)
+            if (ws.index_step(cancel_))
+                return true;
+        return false;
+    }
+
     void launch(std::string file_name, bool stop_on_entry)
     {
         workspaces::workspace& ws = ws_path_match(file_name);
@@ -252,12 +378,12 @@ public:
     }
 
 
-    variables get_variables(var_reference_t var_reference)
+    variables get_variables(var_reference_t var_reference, size_t start, size_t count)
     {
         if (!debugger_)
             return { nullptr, 0 };
 
-        auto& res = debugger_->variables(var_reference);
+        auto& res = debugger_->variables(var_reference, start, count);
         temp_variables_.resize(res.size());
         for (size_t i = 0; i < res.size(); ++i)
             temp_variables_[i] = res[i].get();
@@ -303,18 +429,42 @@ private:
         }
     }
 
+    // Collects diagnostics that are not owned by processor files, those are provided by diags_store_
     virtual void collect_diags() const override
     {
-        collect_diags_from_child(file_manager_);
+        collect_own_diags_from_child(file_manager_);
 
         for (auto& it : workspaces_)
             collect_diags_from_child(it.second);
     }
 
+    // Returns processor file with its analyzer state, the state is rebuilt if it was evicted.
+    workspaces::processor_file_ptr find_resident_processor_file(const std::string& document_uri)
+    {
+        auto file = file_manager_.find(document_uri);
+        if (dynamic_cast<workspaces::processor_file*>(file.get()) == nullptr)
+            return nullptr;
+
+        auto proc_file = file_manager_.find_processor_file(document_uri);
+        if (!proc_file->resident())
+        {
+            ws_path_match(document_uri).restore_file(document_uri);
+            // the libraries may have changed since the file was evicted
+            notify_diagnostics_consumers();
+        }
+
+        return proc_file->resident() ? proc_file : nullptr;
+    }
+
     void notify_highlighting_consumers()
     {
+        // the files are held until the consumers are done with them
         auto file_list = file_manager_.list_updated_files();
-        all_highlighting_info hl_info(file_list.data(), file_list.size());
+        std::vector<file_id> files;
+        files.reserve(file_list.size());
+        for (const auto& file : file_list)
+            files.push_back(file.get());
+        all_highlighting_info hl_info(files.data(), files.size());
         for (auto consumer : hl_consumers_)
         {
             consumer->consume_highlighting_info(hl_info);
@@ -325,7 +475,9 @@ private:
     {
         diags().clear();
         collect_diags();
-        diagnostic_list l(diags().data(), diags().size());
+        diags_store_.begin_update();
+        file_manager_.update_diagnostics_store(diags_store_);
+        diagnostic_list l = diags_store_.end_update(diags());
         for (auto consumer : diag_consumers_)
         {
             consumer->consume_diagnostics(l);
@@ -339,6 +491,7 @@ private:
         if (proc_file)
         {
             auto metrics = proc_file->get_metrics();
+            metrics.resident_memory = file_manager_.resident_memory();
             for (auto consumer : metrics_consumers_)
             {
                 consumer->consume_performance_metrics(metrics);
@@ -360,6 +513,20 @@ private:
         return match;
     }
 
+    // analyzes one dependant waiting in the workspace and publishes the results unless the analysis was preempted
+    bool background_analysis_step(workspaces::workspace& ws)
+    {
+        if (!ws.background_analysis_step())
+            return false;
+        if (cancel_ && *cancel_)
+            return true;
+
+        file_manager_.enforce_memory_budget();
+        notify_highlighting_consumers();
+        notify_diagnostics_consumers();
+        return true;
+    }
+
     // returns implicit workspace, if the file does not belong to any workspace
     workspaces::workspace& ws_path_match(const std::string& document_uri)
     {
@@ -379,12 +546,29 @@ private:
         else
             return *max_ws;
     }
+
+    // each workspace keeps its own file in the storage, the name is derived from the workspace uri
+    std::filesystem::path member_usage_file(const std::string& ws_uri) const
+    {
+        std::ostringstream name;
+        name << "member_usage_" << std::hex << std::hash<std::string>()(ws_uri) << ".json";
+        return std::filesystem::path(storage_path_) / name.str();
+    }
+
     std::vector<debugging::variable*> temp_variables_;
+    context::completion_item_s resolved_item_ = context::completion_item_s("", "", "", std::vector<std::string> {});
+    std::vector<std::string> memory_usage_uris_;
+    std::vector<file_memory_usage> memory_usage_;
+    diagnostics_store diags_store_;
 
     std::unordered_map<std::string, workspaces::workspace> workspaces_;
     workspaces::file_manager_impl file_manager_;
     workspaces::workspace implicit_workspace_;
     std::atomic<bool>* cancel_;
+    // options of the analyses in all workspaces
+    analyzer_options analyzer_options_;
+    // directory keeping state of the workspaces between sessions, nothing is kept when it is empty
+    std::string storage_path_;
 
     std::vector<highlighting_consumer*> hl_consumers_;
     std::vector<diagnostics_consumer*> diag_consumers_;
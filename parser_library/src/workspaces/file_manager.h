@@ -15,6 +15,7 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_FILE_MANAGER_H
 #define HLASMPLUGIN_PARSERLIBRARY_FILE_MANAGER_H
 
+#include <atomic>
 #include <filesystem>
 #include <string>
 #include <unordered_map>
@@ -56,7 +57,11 @@ public:
     virtual std::unordered_map<std::string, std::string> list_directory_files(const std::string& path) = 0;
 
     virtual bool file_exists(const std::string& file_name) = 0;
+    virtual bool dir_exists(const std::string& dir_path) = 0;
     virtual bool lib_file_exists(const std::string& lib_path, const std::string& file_name) = 0;
+    // Loads the file ahead of its first use, so its analysis does not wait for the storage.
+    // Returns false when the loading was stopped by the cancellation token.
+    virtual bool prefetch_file(const std::string& file_name, const std::atomic<bool>* cancel) = 0;
 
     virtual void did_open_file(const std::string& document_uri, version_t version, std::string text) = 0;
     virtual void did_change_file(
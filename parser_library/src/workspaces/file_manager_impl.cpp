@@ -14,6 +14,8 @@
 
 #include "file_manager_impl.h"
 
+#include <algorithm>
+#include <fstream>
 #include <map>
 
 #include "processor_file_impl.h"
@@ -22,17 +24,31 @@ namespace hlasm_plugin::parser_library::workspaces {
 
 void file_manager_impl::collect_diags() const
 {
-    for (auto& it : files_)
-    {
-        collect_diags_from_child(*it.second);
-    }
+    files_.for_each([this](const std::string&, const std::shared_ptr<file_impl>& file) {
+        collect_diags_from_child(*file);
+    });
+}
+
+void file_manager_impl::update_diagnostics_store(diagnostics_store& store)
+{
+    files_.for_each([&store](const std::string& uri, std::shared_ptr<file_impl>& file) {
+        auto proc_file = dynamic_cast<processor_file_impl*>(file.get());
+        if (!proc_file)
+            return;
+        store.update(
+            uri, proc_file->diagnostics_generation(), [proc_file]() { return proc_file->diagnostics_handle(); });
+    });
 }
 
 file_ptr file_manager_impl::add_file(const file_uri& uri)
 {
-    std::lock_guard guard(files_mutex);
-    auto ret = files_.emplace(uri, std::make_shared<file_impl>(uri));
-    return ret.first->second;
+    return files_.emplace(uri, std::make_shared<file_impl>(uri));
+}
+
+std::shared_ptr<processor_file_impl> file_manager_impl::make_processor_file_(std::shared_ptr<processor_file_impl> file)
+{
+    file->set_parse_info_listener(this);
+    return file;
 }
 
 processor_file_ptr file_manager_impl::change_into_processor_file_if_not_already_(std::shared_ptr<file_impl>& to_change)
@@ -42,7 +58,7 @@ processor_file_ptr file_manager_impl::change_into_processor_file_if_not_already_
         return processor;
     else
     {
-        auto proc_file = std::make_shared<processor_file_impl>(std::move(*to_change), cancel_);
+        auto proc_file = make_processor_file_(std::make_shared<processor_file_impl>(std::move(*to_change), cancel_));
         to_change = proc_file;
         return proc_file;
     }
@@ -50,58 +66,152 @@ processor_file_ptr file_manager_impl::change_into_processor_file_if_not_already_
 
 processor_file_ptr file_manager_impl::add_processor_file(const file_uri& uri)
 {
-    std::lock_guard guard(files_mutex);
-    auto ret = files_.find(uri);
-    if (ret == files_.end())
-    {
-        auto ptr = std::make_shared<processor_file_impl>(uri, cancel_);
-        files_.emplace(uri, ptr);
-        return ptr;
-    }
-    else
-        return change_into_processor_file_if_not_already_(ret->second);
+    return files_.access(uri, [this, &uri](file_registry::file_map& files) -> processor_file_ptr {
+        auto ret = files.find(uri);
+        if (ret == files.end())
+        {
+            auto ptr = make_processor_file_(std::make_shared<processor_file_impl>(uri, cancel_));
+            files.emplace(uri, ptr);
+            return ptr;
+        }
+        else
+            return change_into_processor_file_if_not_already_(ret->second);
+    });
 }
 
 void file_manager_impl::remove_file(const file_uri& document_uri)
 {
-    std::lock_guard guard(files_mutex);
-    auto file = files_.find(document_uri);
-    if (file == files_.end())
-        return;
-
     // close the file internally
     files_.erase(document_uri);
 }
 
-file_ptr file_manager_impl::find(const std::string& key)
+file_ptr file_manager_impl::find(const std::string& key) { return files_.find(key); }
+
+processor_file_ptr file_manager_impl::find_processor_file(const std::string& key)
 {
-    std::lock_guard guard(files_mutex);
-    auto ret = files_.find(key);
-    if (ret == files_.end())
-        return nullptr;
+    return files_.access(key, [this, &key](file_registry::file_map& files) -> processor_file_ptr {
+        auto ret = files.find(key);
+        if (ret == files.end())
+            return nullptr;
 
-    return ret->second;
+        return change_into_processor_file_if_not_already_(ret->second);
+    });
 }
 
-processor_file_ptr file_manager_impl::find_processor_file(const std::string& key)
+
+void file_manager_impl::set_memory_budget(size_t bytes) { memory_budget_ = bytes; }
+
+void file_manager_impl::enforce_memory_budget()
 {
-    std::lock_guard guard(files_mutex);
-    auto ret = files_.find(key);
-    if (ret == files_.end())
-        return nullptr;
+    if (memory_budget_ == 0)
+        return;
+
+    size_t total = 0;
+    // the files are held, so they stay alive even if they are removed or replaced during the eviction
+    std::vector<std::shared_ptr<processor_file>> candidates;
+    files_.for_each([&total, &candidates](const std::string&, std::shared_ptr<file_impl>& file) {
+        auto proc_file = std::dynamic_pointer_cast<processor_file>(file);
+        if (!proc_file || !proc_file->resident())
+            return;
+        total += proc_file->resident_memory();
+        if (!proc_file->get_lsp_editing())
+            candidates.push_back(std::move(proc_file));
+    });
+
+    if (total <= memory_budget_)
+        return;
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs->last_used() < rhs->last_used();
+    });
+
+    for (auto& proc_file : candidates)
+    {
+        if (total <= memory_budget_)
+            break;
+        // may have been evicted as a dependency of another file
+        if (!proc_file->resident())
+            continue;
+        // open dependencies were parsed in the context owned by this file
+        if (has_open_dependency_(*proc_file))
+            continue;
+        total -= std::min(total, evict_(*proc_file));
+    }
+}
 
-    return change_into_processor_file_if_not_already_(ret->second);
+size_t file_manager_impl::resident_memory()
+{
+    size_t total = 0;
+    files_.for_each([&total](const std::string&, std::shared_ptr<file_impl>& file) {
+        if (auto proc_file = dynamic_cast<processor_file*>(file.get()))
+            total += proc_file->resident_memory();
+    });
+    return total;
 }
 
+std::vector<processor_file_ptr> file_manager_impl::list_processor_files()
+{
+    std::vector<processor_file_ptr> list;
+    files_.for_each([&list](const std::string&, std::shared_ptr<file_impl>& file) {
+        if (auto proc_file = std::dynamic_pointer_cast<processor_file>(file))
+            list.push_back(std::move(proc_file));
+    });
+    return list;
+}
 
-std::vector<processor_file*> file_manager_impl::list_updated_files()
+std::shared_ptr<processor_file> file_manager_impl::find_processor_file_(const std::string& key)
 {
-    std::vector<processor_file*> list;
-    for (auto& item : files_)
+    return std::dynamic_pointer_cast<processor_file>(files_.find(key));
+}
+
+bool file_manager_impl::has_open_dependency_(processor_file& file)
+{
+    for (auto& dependency : file.dependencies())
+    {
+        auto found = files_.find(dependency);
+        if (found && found->get_lsp_editing())
+            return true;
+    }
+    return false;
+}
+
+size_t file_manager_impl::evict_(processor_file& file)
+{
+    size_t released = file.resident_memory();
+    file.evict();
+
+    // analyzers of dependencies may refer to the context that was owned by the file
+    for (auto& dependency : file.dependencies())
+    {
+        auto dep_file = find_processor_file_(dependency);
+        if (!dep_file || !dep_file->resident() || dep_file->get_lsp_editing())
+            continue;
+        released += dep_file->resident_memory();
+        dep_file->evict();
+    }
+    return released;
+}
+
+void file_manager_impl::parse_info_updated(const std::string& file_name)
+{
+    std::lock_guard guard(updated_files_mutex_);
+    updated_files_.insert(file_name);
+}
+
+std::vector<processor_file_ptr> file_manager_impl::list_updated_files()
+{
+    std::unordered_set<std::string> updated;
+    {
+        std::lock_guard guard(updated_files_mutex_);
+        updated.swap(updated_files_);
+    }
+
+    std::vector<processor_file_ptr> list;
+    for (const auto& uri : updated)
     {
-        auto p = dynamic_cast<processor_file*>(item.second.get());
+        auto p = find_processor_file_(uri);
         if (p && p->parse_info_updated())
-            list.push_back(p);
+            list.push_back(std::move(p));
     }
     return list;
 }
@@ -139,22 +249,24 @@ std::unordered_map<std::string, std::string> file_manager_impl::list_directory_f
 
 void file_manager_impl::prepare_file_for_change_(std::shared_ptr<file_impl>& file)
 {
-    if (file.unique())
+    // the registry lock is held, so no other owner can appear while the file is changed in place
+    if (file.use_count() == 1)
         return;
     // another shared ptr to this file exists, we need to create a copy
     auto proc_file = std::dynamic_pointer_cast<processor_file>(file);
     if (proc_file)
-        file = std::make_shared<processor_file_impl>(*file, cancel_);
+        file = make_processor_file_(std::make_shared<processor_file_impl>(*file, cancel_));
     else
         file = std::make_shared<file_impl>(*file);
 }
 
 void file_manager_impl::did_open_file(const std::string& document_uri, version_t version, std::string text)
 {
-    std::lock_guard guard(files_mutex);
-    auto ret = files_.emplace(document_uri, std::make_shared<file_impl>(document_uri));
-    prepare_file_for_change_(ret.first->second);
-    ret.first->second->did_open(std::move(text), version);
+    files_.access(document_uri, [&](file_registry::file_map& files) {
+        auto ret = files.emplace(document_uri, std::make_shared<file_impl>(document_uri));
+        prepare_file_for_change_(ret.first->second);
+        ret.first->second->did_open(std::move(text), version);
+    });
 }
 
 void file_manager_impl::did_change_file(
@@ -164,36 +276,37 @@ void file_manager_impl::did_change_file(
     // should we just overwrite the version??
     // on the other hand, the spec clearly specifies that each change increments version by one.
 
-    std::lock_guard guard(files_mutex);
+    files_.access(document_uri, [&](file_registry::file_map& files) {
+        auto file = files.find(document_uri);
+        if (file == files.end())
+            return; // if the file does not exist, no action is taken
 
-    auto file = files_.find(document_uri);
-    if (file == files_.end())
-        return; // if the file does not exist, no action is taken
+        prepare_file_for_change_(file->second);
 
-    prepare_file_for_change_(file->second);
-
-    for (size_t i = 0; i < ch_size; ++i)
-    {
-        std::string text_s(changes[i].text, changes[i].text_length);
-        if (changes[i].whole)
-            file->second->did_change(std::move(text_s));
-        else
-            file->second->did_change(changes[i].change_range, std::move(text_s));
-    }
+        for (size_t i = 0; i < ch_size; ++i)
+        {
+            std::string text_s(changes[i].text, changes[i].text_length);
+            if (changes[i].whole)
+                file->second->did_change(std::move(text_s));
+            else
+                file->second->did_change(changes[i].change_range, std::move(text_s));
+        }
+    });
 }
 
 void file_manager_impl::did_close_file(const std::string& document_uri)
 {
-    std::lock_guard guard(files_mutex);
-    auto file = files_.find(document_uri);
-    if (file == files_.end())
-        return;
+    files_.access(document_uri, [&](file_registry::file_map& files) {
+        auto file = files.find(document_uri);
+        if (file == files.end())
+            return;
 
-    prepare_file_for_change_(file->second);
-    // close the file externally
-    file->second->did_close();
+        prepare_file_for_change_(file->second);
+        // close the file externally
+        file->second->did_close();
 
-    // if the file does not exist, no action is taken
+        // if the file does not exist, no action is taken
+    });
 }
 
 bool file_manager_impl::file_exists(const std::string& file_name)
@@ -203,6 +316,12 @@ bool file_manager_impl::file_exists(const std::string& file_name)
     // TODO use error code??
 }
 
+bool file_manager_impl::dir_exists(const std::string& dir_path)
+{
+    std::error_code ec;
+    return std::filesystem::is_directory(dir_path, ec);
+}
+
 bool file_manager_impl::lib_file_exists(const std::string& lib_path, const std::string& file_name)
 {
     std::filesystem::path lib_path_p(lib_path);
@@ -210,4 +329,24 @@ bool file_manager_impl::lib_file_exists(const std::string& lib_path, const std::
     return std::filesystem::exists(file_path);
 }
 
+bool file_manager_impl::prefetch_file(const std::string& file_name, const std::atomic<bool>* cancel)
+{
+    // the text of an added file is already loaded
+    if (files_.find(file_name))
+        return true;
+
+    if (cancel && *cancel)
+        return false;
+
+    // the file is loaded only when its text fits into the memory budget next to the analyzers
+    std::error_code ec;
+    auto size = std::filesystem::file_size(file_name, ec);
+    if (ec || (memory_budget_ != 0 && resident_memory() + size > memory_budget_))
+        return true;
+
+    // the first program using the file takes it from the file manager with its text
+    add_processor_file(file_name)->update_and_get_bad();
+    return true;
+}
+
 } // namespace hlasm_plugin::parser_library::workspaces
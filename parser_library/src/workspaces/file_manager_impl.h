@@ -16,9 +16,13 @@
 #define HLASMPLUGIN_PARSERLIBRARY_FILE_MANAGER_IMPL_H
 
 #include <memory>
+#include <mutex>
+#include <unordered_set>
 
 #include "diagnosable_impl.h"
+#include "diagnostics_store.h"
 #include "file_manager.h"
+#include "file_registry.h"
 #include "processor_file_impl.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
@@ -27,7 +31,10 @@ namespace hlasm_plugin::parser_library::workspaces {
 #pragma warning(disable : 4250)
 
 // Implementation of the file_manager interface.
-class file_manager_impl : public file_manager, public diagnosable_impl
+// Files are kept in a sharded registry, so the file manager may be used by several threads at once.
+// Files leave the registry only as shared pointers. A file is changed in place only when the registry
+// is its only owner, otherwise the registry gets a changed copy and the other owners keep the old file.
+class file_manager_impl : public file_manager, public diagnosable_impl, private parse_info_listener
 {
 public:
     file_manager_impl(std::atomic<bool>* cancel = nullptr)
@@ -39,6 +46,8 @@ public:
     file_manager_impl& operator=(file_manager_impl&&) = delete;
 
     virtual void collect_diags() const override;
+    // Refreshes store with diagnostics of processor files, unchanged files are skipped.
+    void update_diagnostics_store(diagnostics_store& store);
 
     virtual file_ptr add_file(const file_uri&) override;
     virtual processor_file_ptr add_processor_file(const file_uri&) override;
@@ -48,7 +57,7 @@ public:
     virtual processor_file_ptr find_processor_file(const std::string& key) override;
 
     // Returns array of files that were updated since this method was last called
-    virtual std::vector<processor_file*> list_updated_files();
+    virtual std::vector<processor_file_ptr> list_updated_files();
     virtual std::unordered_map<std::string, std::string> list_directory_files(const std::string& path) override;
 
     virtual void did_open_file(const std::string& document_uri, version_t version, std::string text) override;
@@ -57,20 +66,40 @@ public:
     virtual void did_close_file(const std::string& document_uri) override;
 
     virtual bool file_exists(const std::string& file_name) override;
+    virtual bool dir_exists(const std::string& dir_path) override;
     virtual bool lib_file_exists(const std::string& lib_path, const std::string& file_name) override;
+    virtual bool prefetch_file(const std::string& file_name, const std::atomic<bool>* cancel) override;
+
+    // Sets limit of memory held by analyzers of processor files, 0 means unlimited.
+    void set_memory_budget(size_t bytes);
+    // Evicts analyzers of least recently used files that are not open in the editor until the budget is met.
+    void enforce_memory_budget();
+    // Returns estimated memory held by analyzers of all processor files.
+    size_t resident_memory();
+    // Returns all processor files, including those whose analyzer was evicted.
+    std::vector<processor_file_ptr> list_processor_files();
 
     virtual ~file_manager_impl() = default;
 
 protected:
-    std::unordered_map<std::string, std::shared_ptr<file_impl>> files_;
+    file_registry files_;
 
 private:
-    std::mutex files_mutex;
-
     std::atomic<bool>* cancel_;
 
+    // uris of files whose parse info was updated since list_updated_files was last called
+    std::mutex updated_files_mutex_;
+    std::unordered_set<std::string> updated_files_;
+    void parse_info_updated(const std::string& file_name) override;
+
+    size_t memory_budget_ = 0;
+
+    std::shared_ptr<processor_file_impl> make_processor_file_(std::shared_ptr<processor_file_impl> file);
     processor_file_ptr change_into_processor_file_if_not_already_(std::shared_ptr<file_impl>& ret);
     void prepare_file_for_change_(std::shared_ptr<file_impl>& file);
+    std::shared_ptr<processor_file> find_processor_file_(const std::string& key);
+    bool has_open_dependency_(processor_file& file);
+    size_t evict_(processor_file& file);
 };
 
 #pragma warning(pop)
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include "file_registry.h"
+
+#include <functional>
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+std::shared_ptr<file_impl> file_registry::emplace(const std::string& uri, std::shared_ptr<file_impl> file)
+{
+    return access(uri, [&uri, &file](file_map& files) { return files.emplace(uri, std::move(file)).first->second; });
+}
+
+std::shared_ptr<file_impl> file_registry::find(const std::string& uri) const
+{
+    auto& s = shard_of(uri);
+    std::lock_guard guard(s.mtx);
+    auto found = s.files.find(uri);
+    if (found == s.files.end())
+        return nullptr;
+    return found->second;
+}
+
+void file_registry::erase(const std::string& uri)
+{
+    access(uri, [&uri](file_map& files) { files.erase(uri); });
+}
+
+file_registry::shard& file_registry::shard_of(const std::string& uri)
+{
+    return shards_[std::hash<std::string>()(uri) % shard_count];
+}
+
+const file_registry::shard& file_registry::shard_of(const std::string& uri) const
+{
+    return shards_[std::hash<std::string>()(uri) % shard_count];
+}
+
+} // namespace hlasm_plugin::parser_library::workspaces
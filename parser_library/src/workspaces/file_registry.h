@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_FILE_REGISTRY_H
+#define HLASMPLUGIN_PARSERLIBRARY_FILE_REGISTRY_H
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "file_impl.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+// Map of files owned by a file manager. The files are split into shards by the hash of their uri and each shard
+// has its own lock, so threads that look up different files rarely wait for each other.
+// Stored files are replaced rather than modified when they change (see file_manager_impl), so a file obtained from
+// the registry may be used after the lock of its shard was released.
+class file_registry
+{
+public:
+    using file_map = std::unordered_map<std::string, std::shared_ptr<file_impl>>;
+
+    // Stores the file unless there already is a file with the same uri, returns the stored file.
+    std::shared_ptr<file_impl> emplace(const std::string& uri, std::shared_ptr<file_impl> file);
+    // Returns the file with the uri or nullptr.
+    std::shared_ptr<file_impl> find(const std::string& uri) const;
+    void erase(const std::string& uri);
+
+    // Calls f with the files of the shard that contains the uri while the shard is locked.
+    template<typename F> decltype(auto) access(const std::string& uri, F&& f)
+    {
+        auto& s = shard_of(uri);
+        std::lock_guard guard(s.mtx);
+        return f(s.files);
+    }
+
+    // Calls f(uri, file) for each stored file. Only one shard is locked at a time, so f must not access the registry.
+    template<typename F> void for_each(F&& f)
+    {
+        for (auto& s : shards_)
+        {
+            std::lock_guard guard(s.mtx);
+            for (auto& [uri, file] : s.files)
+                f(uri, file);
+        }
+    }
+    template<typename F> void for_each(F&& f) const
+    {
+        for (const auto& s : shards_)
+        {
+            std::lock_guard guard(s.mtx);
+            for (const auto& [uri, file] : s.files)
+                f(uri, file);
+        }
+    }
+
+private:
+    static constexpr size_t shard_count = 16;
+
+    struct shard
+    {
+        mutable std::mutex mtx;
+        file_map files;
+    };
+
+    shard& shard_of(const std::string& uri);
+    const shard& shard_of(const std::string& uri) const;
+
+    std::array<shard, shard_count> shards_;
+};
+
+} // namespace hlasm_plugin::parser_library::workspaces
+
+#endif // !HLASMPLUGIN_PARSERLIBRARY_FILE_REGISTRY_H
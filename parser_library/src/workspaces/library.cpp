@@ -16,7 +16,6 @@
 
 #include <filesystem>
 #include <locale>
-#include <regex>
 
 #include "json.hpp"
 
@@ -25,7 +24,7 @@
 namespace hlasm_plugin::parser_library::workspaces {
 
 library_local::library_local(
-    file_manager& file_manager, std::string lib_path, std::shared_ptr<const extension_regex_map> extensions)
+    file_manager& file_manager, std::string lib_path, std::shared_ptr<const extension_wildcard_map> extensions)
     : file_manager_(file_manager)
     , lib_path_(lib_path)
     , extensions_(extensions)
@@ -47,6 +46,49 @@ void library_local::refresh()
     load_files();
 }
 
+void library_local::prefetch()
+{
+    if (!files_loaded_)
+        load_files();
+}
+
+std::vector<std::string> library_local::refresh(const std::string& file_path)
+{
+    // members of a library that was not loaded yet cannot be cached anywhere
+    if (!files_loaded_)
+        return {};
+
+    std::filesystem::path path(file_path);
+    if ((path.parent_path() / "").lexically_normal() != (std::filesystem::path(lib_path_) / "").lexically_normal())
+        return {};
+
+    auto file_name = path.filename().string();
+    auto member = member_name(file_name, file_path);
+    auto found = files_.find(member);
+
+    if (file_manager_.file_exists(file_path))
+    {
+        if (found != files_.end())
+            return {};
+        files_.emplace(member, file_name);
+    }
+    else
+    {
+        // the member may be provided by another file with different extension
+        if (found == files_.end() || std::filesystem::path(found->second).filename() != file_name)
+            return {};
+        files_.erase(found);
+    }
+    return { member };
+}
+
+bool library_local::in_directory(const std::string& dir_path) const
+{
+    auto lib = (std::filesystem::path(lib_path_) / "").lexically_normal().string();
+    auto dir = (std::filesystem::path(dir_path) / "").lexically_normal().string();
+    return lib.compare(0, dir.size(), dir) == 0;
+}
+
 const std::string& library_local::get_lib_path() const { return lib_path_; }
 
 std::shared_ptr<processor> library_local::find_file(const std::string& file_name)
@@ -64,30 +106,33 @@ std::shared_ptr<processor> library_local::find_file(const std::string& file_name
         return nullptr;
 }
 
+bool library_local::has_file(const std::string& file_name)
+{
+    if (!files_loaded_)
+        load_files();
+
+    return files_.find(file_name) != files_.end();
+}
+
+
+std::string library_local::member_name(const std::string& file_name, const std::string& file_path) const
+{
+    for (const auto& extension : *extensions_)
+    {
+        // current file matches wildcard (it has extension)
+        // e.g. file "files/open.hlasm" matches both extensions "files/*.hlasm" and "*.hlasm"
+        if (extension.first.size() < file_path.size() && extension.second.match(file_path))
+            return context::to_upper_copy(file_name.substr(0, file_name.size() - extension.first.size()));
+    }
+    return context::to_upper_copy(file_name);
+}
 
 void library_local::load_files()
 {
     auto files_list = file_manager_.list_directory_files(lib_path_);
     files_.clear();
     for (const auto& file : files_list)
-    {
-        bool added = false;
-
-        for (const auto& extension : *extensions_)
-        {
-            // current file matches regex (it has extension)
-            // e.g. file "files/open.hlasm" matches both extensions "files/*.hlasm" and "*.hlasm"
-            if (extension.first.size() < file.second.size() && std::regex_match(file.second, extension.second))
-            {
-                files_[context::to_upper_copy(file.first.substr(0, file.first.size() - extension.first.size()))] =
-                    file.second;
-                added = true;
-                break;
-            }
-        }
-        if (!added)
-            files_[context::to_upper_copy(file.first)] = file.second;
-    }
+        files_[member_name(file.first, file.second)] = file.second;
 
     files_loaded_ = true;
 }
@@ -18,11 +18,14 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "diagnosable_impl.h"
 #include "file_manager.h"
+#include "wildcard.h"
 
-using extension_regex_map = std::unordered_multimap<std::string, std::regex>;
+using extension_wildcard_map =
+    std::unordered_multimap<std::string, hlasm_plugin::parser_library::workspaces::wildcard>;
 
 namespace hlasm_plugin::parser_library::workspaces {
 
@@ -30,7 +33,16 @@ class library : public virtual diagnosable
 {
 public:
     virtual std::shared_ptr<processor> find_file(const std::string& file) = 0;
+    // checks whether the library contains the member without opening it
+    virtual bool has_file(const std::string& file) = 0;
     virtual void refresh() = 0;
+    // loads the list of members if it was not loaded yet, so that the first lookup does not have to
+    virtual void prefetch() = 0;
+    // updates the library after the file on file_path was created, changed or deleted
+    // returns names of members that were added or removed
+    virtual std::vector<std::string> refresh(const std::string& file_path) = 0;
+    // checks whether the library directory is dir_path or lies inside of it
+    virtual bool in_directory(const std::string& dir_path) const = 0;
 
 private:
 };
@@ -45,7 +57,7 @@ public:
     // takes reference to file manager that provides access to the files
     // and normalised path to directory that it wraps.
     library_local(
-        file_manager& file_manager, std::string lib_path, std::shared_ptr<const extension_regex_map> extensions);
+        file_manager& file_manager, std::string lib_path, std::shared_ptr<const extension_wildcard_map> extensions);
 
     library_local(const library_local&) = delete;
     library_local& operator=(const library_local&) = delete;
@@ -58,18 +70,28 @@ public:
 
     virtual std::shared_ptr<processor> find_file(const std::string& file) override;
 
-    // this function should be called from workspace, once watchedFilesChanged request is implemented
+    virtual bool has_file(const std::string& file) override;
+
     virtual void refresh() override;
 
+    virtual void prefetch() override;
+
+    // only the member stored in file_path is updated, files outside of the library directory are ignored
+    virtual std::vector<std::string> refresh(const std::string& file_path) override;
+
+    virtual bool in_directory(const std::string& dir_path) const override;
+
 private:
     file_manager& file_manager_;
 
     std::string lib_path_;
     std::unordered_map<std::string, std::string> files_;
-    std::shared_ptr<const extension_regex_map> extensions_;
+    std::shared_ptr<const extension_wildcard_map> extensions_;
     // indicates whether load_files function was called (not whether it was succesful)
     bool files_loaded_ = false;
 
+    // strips recognized extension from the file name and converts it to the member name
+    std::string member_name(const std::string& file_name, const std::string& file_path) const;
     void load_files();
 };
 #pragma warning(pop)
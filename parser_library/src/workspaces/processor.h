@@ -32,8 +32,8 @@ class processor : public virtual diagnosable
 public:
     virtual bool parse_info_updated() = 0;
 
-    // starts parser with new (empty) context
-    virtual parse_result parse(parse_lib_provider&) = 0;
+    // starts parser with new (empty) context configured by the options
+    virtual parse_result parse(parse_lib_provider&, analyzer_options options = {}) = 0;
     // starts parser with in the context of parameter
     virtual parse_result parse_macro(parse_lib_provider&, context::hlasm_context&, const library_data) = 0;
     // starts parser to parse macro but does not update parse info or diagnostics
@@ -49,6 +49,20 @@ public:
     virtual const semantics::lsp_info_processor get_lsp_info() = 0;
     virtual const std::set<std::string>& files_to_close() = 0;
     virtual const performance_metrics& get_metrics() = 0;
+
+    // releases the analyzer state of the file, diagnostics, dependencies and metrics are kept
+    // the state is built again by the next parse of the file
+    virtual void evict() = 0;
+    // returns true if the analyzer state of the file is held in memory
+    virtual bool resident() const = 0;
+    // estimated size of the analyzer state in bytes
+    virtual size_t resident_memory() const = 0;
+    // estimated memory held by the analyzer state broken down by structures, empty when the state was evicted
+    virtual memory_usage get_memory_usage() = 0;
+    // returns number that increases each time the file is parsed or its parse info is used
+    virtual size_t last_used() const = 0;
+    // context of the last analysis of the file, nullptr when the analyzer state was evicted
+    virtual context::hlasm_context* analysis_context() = 0;
 };
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -14,6 +14,7 @@
 
 #include "processor_file_impl.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -21,6 +22,21 @@
 
 namespace hlasm_plugin::parser_library::workspaces {
 
+namespace {
+// generations are unique across all files, so a file replaced by its copy is never mistaken for unchanged
+size_t next_diags_generation()
+{
+    static std::atomic<size_t> generation(0);
+    return ++generation;
+}
+
+size_t next_use()
+{
+    static std::atomic<size_t> use(0);
+    return ++use;
+}
+} // namespace
+
 processor_file_impl::processor_file_impl(std::string file_name, std::atomic<bool>* cancel)
     : file_impl(std::move(file_name))
     , cancel_(cancel)
@@ -33,15 +49,23 @@ processor_file_impl::processor_file_impl(file_impl&& f_impl, std::atomic<bool>*
 
 processor_file_impl::processor_file_impl(const file_impl& file, std::atomic<bool>* cancel)
     : file_impl(file)
+    , cancel_(cancel)
 {}
 
 void processor_file_impl::collect_diags() const { file_impl::collect_diags(); }
 
 bool processor_file_impl::is_once_only() const { return false; }
 
-parse_result processor_file_impl::parse(parse_lib_provider& lib_provider)
+processor_file_impl::diagnostic_container& processor_file_impl::diags() const { return *diags_; }
+
+diagnostic_handle processor_file_impl::diagnostics_handle() const { return diags_; }
+
+size_t processor_file_impl::diagnostics_generation() const { return diags_generation_; }
+
+parse_result processor_file_impl::parse(parse_lib_provider& lib_provider, analyzer_options options)
 {
-    analyzer_ = std::make_unique<analyzer>(get_text(), get_file_name(), lib_provider, nullptr, get_lsp_editing());
+    analyzer_ =
+        std::make_unique<analyzer>(get_text(), get_file_name(), lib_provider, nullptr, get_lsp_editing(), options);
 
     auto old_dep = dependencies_;
 
@@ -92,30 +116,84 @@ bool processor_file_impl::parse_info_updated()
     return ret;
 }
 
+void processor_file_impl::set_parse_info_listener(parse_info_listener* listener) { parse_info_listener_ = listener; }
+
 const std::set<std::string>& processor_file_impl::dependencies() { return dependencies_; }
 
-const file_highlighting_info processor_file_impl::get_hl_info() { return analyzer_->lsp_processor().get_hl_info(); }
+const file_highlighting_info processor_file_impl::get_hl_info()
+{
+    touch();
+    return analyzer_->lsp_processor().get_hl_info();
+}
 
-const semantics::lsp_info_processor processor_file_impl::get_lsp_info() { return analyzer_->lsp_processor(); }
+const semantics::lsp_info_processor processor_file_impl::get_lsp_info()
+{
+    touch();
+    return analyzer_->lsp_processor();
+}
 
 const std::set<std::string>& processor_file_impl::files_to_close() { return files_to_close_; }
 
-const performance_metrics& processor_file_impl::get_metrics() { return analyzer_->get_metrics(); }
+const performance_metrics& processor_file_impl::get_metrics()
+{
+    if (analyzer_)
+        metrics_ = analyzer_->get_metrics();
+    return metrics_;
+}
+
+void processor_file_impl::evict()
+{
+    analyzer_.reset();
+    no_update_analyzer_.reset();
+    resident_memory_ = 0;
+}
+
+bool processor_file_impl::resident() const { return analyzer_ != nullptr; }
+
+size_t processor_file_impl::resident_memory() const { return resident_memory_; }
+
+memory_usage processor_file_impl::get_memory_usage()
+{
+    return analyzer_ ? analyzer_->get_memory_usage() : memory_usage();
+}
+
+size_t processor_file_impl::last_used() const { return last_used_; }
+
+context::hlasm_context* processor_file_impl::analysis_context() { return analyzer_ ? &analyzer_->context() : nullptr; }
+
+void processor_file_impl::touch() { last_used_ = next_use(); }
 
 bool processor_file_impl::parse_inner(analyzer& new_analyzer)
 {
-    diags().clear();
+    // handles to the previous diagnostics may still be held, so they are replaced rather than cleared
+    auto previous_diags = std::move(diags_);
+    auto previous_generation = diags_generation_;
+    diags_ = std::make_shared<diagnostic_container>();
+    diags_generation_ = next_diags_generation();
 
     new_analyzer.analyze(cancel_);
 
     collect_diags_from_child(new_analyzer);
 
+    metrics_ = new_analyzer.get_metrics();
+    resident_memory_ = new_analyzer.get_memory_usage().total();
+    touch();
+
     // collect semantic info if the file is open in IDE
     if (get_lsp_editing())
+    {
         parse_info_updated_ = true;
+        if (parse_info_listener_)
+            parse_info_listener_->parse_info_updated(get_file_name());
+    }
 
     if (cancel_ && *cancel_)
+    {
+        // the interrupted analysis is repeated, until then the diagnostics of the last complete one are published
+        diags_ = std::move(previous_diags);
+        diags_generation_ = previous_generation;
         return false;
+    }
     return true;
 }
 
@@ -16,11 +16,23 @@
 #define HLASMPLUGIN_PARSERLIBRARY_PROCESSOR_FILE_H
 
 #include "analyzer.h"
+#include "diagnostics_store.h"
 #include "file_impl.h"
 #include "processor.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
 
+// Receives notifications about processor files whose parse info was updated by parsing.
+// Notifications may come from any thread that parses a file.
+class parse_info_listener
+{
+public:
+    virtual void parse_info_updated(const std::string& file_name) = 0;
+
+protected:
+    ~parse_info_listener() = default;
+};
+
 // Implementation of the processor_file interface. Uses analyzer to parse the file
 // Then stores it until the next parsing so it is possible to retrieve parsing
 // information from it.
@@ -32,8 +44,14 @@ public:
     processor_file_impl(const file_impl& file, std::atomic<bool>* cancel = nullptr);
     void collect_diags() const override;
     bool is_once_only() const override;
+    diagnostic_container& diags() const override;
+
+    // Returns shared handle to current diagnostics of the file, it is not modified by subsequent parsing.
+    diagnostic_handle diagnostics_handle() const;
+    // Returns number that changes each time the diagnostics of the file are replaced.
+    size_t diagnostics_generation() const;
     // Starts parser with new (empty) context
-    virtual parse_result parse(parse_lib_provider&) override;
+    virtual parse_result parse(parse_lib_provider&, analyzer_options options = {}) override;
     // Starts parser with in the context of parameter
     virtual parse_result parse_macro(parse_lib_provider&, context::hlasm_context&, const library_data) override;
     // Starts parser with in the context of parameter, but does not affect LSP, HL info or parse_info_updated.
@@ -43,6 +61,10 @@ public:
     // Returns true if parsing occured since this method was called last.
     bool parse_info_updated() override;
 
+    // Sets the listener notified each time parse_info_updated starts returning true, may be null.
+    // The listener must outlive the file.
+    void set_parse_info_listener(parse_info_listener* listener);
+
     const std::set<std::string>& dependencies() override;
 
     virtual ~processor_file_impl() = default;
@@ -51,6 +73,13 @@ public:
     virtual const std::set<std::string>& files_to_close() override;
     virtual const performance_metrics& get_metrics() override;
 
+    void evict() override;
+    bool resident() const override;
+    size_t resident_memory() const override;
+    memory_usage get_memory_usage() override;
+    size_t last_used() const override;
+    context::hlasm_context* analysis_context() override;
+
 private:
     std::unique_ptr<analyzer> analyzer_;
     // This is here only because CA expressions need parser to be alive to evaluate
@@ -59,10 +88,20 @@ private:
     bool parse_inner(analyzer&);
 
     bool parse_info_updated_ = false;
+    parse_info_listener* parse_info_listener_ = nullptr;
     std::atomic<bool>* cancel_;
 
     std::set<std::string> dependencies_;
     std::set<std::string> files_to_close_;
+
+    mutable diagnostic_handle diags_ = std::make_shared<diagnostic_container>();
+    size_t diags_generation_ = 0;
+
+    // summary of the last parse that outlives the analyzer
+    performance_metrics metrics_;
+    size_t resident_memory_ = 0;
+    size_t last_used_ = 0;
+    void touch();
 };
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -15,6 +15,10 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_PROCESSOR_GROUP_H
 #define HLASMPLUGIN_PARSERLIBRARY_PROCESSOR_GROUP_H
 
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
 #include "diagnosable_impl.h"
 #include "library.h"
 
@@ -42,6 +46,29 @@ public:
 
     const std::vector<std::unique_ptr<library>>& libraries() const { return libs_; }
 
+    // reloads all libraries
+    void refresh_libraries()
+    {
+        for (auto&& lib : libs_)
+            lib->refresh();
+    }
+
+    // updates libraries affected by change of the file on file_path, returns names of members added or removed
+    std::vector<std::string> refresh_libraries(const std::string& file_path)
+    {
+        std::vector<std::string> members;
+        for (auto&& lib : libs_)
+            for (auto& member : lib->refresh(file_path))
+                members.push_back(std::move(member));
+        return members;
+    }
+
+    // checks whether the path is the directory of one of the libraries or one of its parent directories
+    bool has_library_directory(const std::string& path) const
+    {
+        return std::any_of(libs_.begin(), libs_.end(), [&path](const auto& lib) { return lib->in_directory(path); });
+    }
+
 private:
     std::vector<std::unique_ptr<library>> libs_;
     std::string name_;
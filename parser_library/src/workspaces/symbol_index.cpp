@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include "symbol_index.h"
+
+#include <algorithm>
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+bool index_symbol::operator==(const index_symbol& other) const
+{
+    return kind == other.kind && definition_range == other.definition_range && name == other.name
+        && file == other.file;
+}
+
+size_t index_symbol_hash::operator()(const index_symbol& symbol) const
+{
+    size_t h = std::hash<std::string>()(symbol.name);
+    h = h * 31 + std::hash<std::string>()(symbol.file);
+    h = h * 31 + (size_t)symbol.definition_range.start.line;
+    h = h * 31 + (size_t)symbol.definition_range.start.column;
+    return h * 31 + (size_t)symbol.kind;
+}
+
+bool index_occurrence::operator==(const index_occurrence& other) const
+{
+    return occurrence_range == other.occurrence_range && file == other.file;
+}
+
+namespace {
+using symbol_map = std::unordered_map<index_symbol, std::vector<index_occurrence>, index_symbol_hash>;
+
+template<typename T>
+void collect(symbol_map& symbols,
+    context::id_storage& files,
+    workspace_symbol_kind kind,
+    const T& definition,
+    const std::vector<context::occurence>& occs)
+{
+    if (!definition.name || !definition.file_name)
+        return;
+    auto& occurrences =
+        symbols[index_symbol { kind, *definition.name, *definition.file_name, definition.definition_range }];
+    for (const auto& occ : occs)
+        if (occ.file_name)
+            occurrences.push_back({ files.add(*occ.file_name, true), occ.symbol_range });
+}
+
+bool occurrence_less(const index_occurrence& l, const index_occurrence& r)
+{
+    const auto& lr = l.occurrence_range;
+    const auto& rr = r.occurrence_range;
+    return std::tie(*l.file, lr.start.line, lr.start.column, lr.end.line, lr.end.column)
+        < std::tie(*r.file, rr.start.line, rr.start.column, rr.end.line, rr.end.column);
+}
+} // namespace
+
+void symbol_index::update(const std::string& program, context::hlasm_context& ctx)
+{
+    remove(program);
+
+    symbol_map symbols;
+    const auto& lsp = *ctx.lsp_ctx;
+    for (const auto& [definition, occs] : lsp.instructions)
+        // machine and assembler instructions have no version
+        if (definition.version != (size_t)-1)
+            collect(symbols, files_, workspace_symbol_kind::macro, definition, occs);
+
+    const auto& copy_members = ctx.copy_members();
+    for (const auto& [definition, occs] : lsp.ord_symbols)
+    {
+        // names of copy members are defined by the first statement of the member
+        auto member = copy_members.find(definition.name);
+        bool is_member = member != copy_members.end() && definition.file_name
+            && member->second.definition_location.file == *definition.file_name;
+        collect(symbols,
+            files_,
+            is_member ? workspace_symbol_kind::copy_member : workspace_symbol_kind::ordinary,
+            definition,
+            occs);
+    }
+
+    for (const auto& [definition, occs] : lsp.seq_symbols)
+        collect(symbols, files_, workspace_symbol_kind::sequence, definition, occs);
+
+    auto& program_symbols = programs_[program];
+    program_symbols.reserve(symbols.size());
+    for (auto& [symbol, occurrences] : symbols)
+        add_symbol(program, symbol, std::move(occurrences));
+}
+
+void symbol_index::add_symbol(
+    const std::string& program, index_symbol symbol, std::vector<index_occurrence> occurrences)
+{
+    auto [it, inserted] = symbols_.try_emplace(std::move(symbol));
+    const index_symbol* stored = &it->first;
+    if (inserted)
+    {
+        by_name_.emplace(stored->name, stored);
+        by_definition_.try_emplace(
+            definition_key(stored->file, stored->definition_range.start.line, stored->definition_range.start.column),
+            stored);
+    }
+    it->second[program] = std::move(occurrences);
+    programs_[program].push_back(stored);
+}
+
+void symbol_index::remove(const std::string& program)
+{
+    auto found = programs_.find(program);
+    if (found == programs_.end())
+        return;
+
+    for (const index_symbol* symbol : found->second)
+    {
+        auto it = symbols_.find(*symbol);
+        it->second.erase(program);
+        if (!it->second.empty())
+            continue;
+
+        // the symbol is not used by any program anymore
+        auto [first, last] = by_name_.equal_range(symbol->name);
+        for (; first != last; ++first)
+            if (first->second == symbol)
+            {
+                by_name_.erase(first);
+                break;
+            }
+        auto definition = by_definition_.find(
+            definition_key(symbol->file, symbol->definition_range.start.line, symbol->definition_range.start.column));
+        if (definition != by_definition_.end() && definition->second == symbol)
+            by_definition_.erase(definition);
+        symbols_.erase(it);
+    }
+    programs_.erase(found);
+}
+
+std::vector<const index_symbol*> symbol_index::find(std::string_view prefix, size_t limit) const
+{
+    std::vector<const index_symbol*> result;
+    for (auto it = by_name_.lower_bound(prefix);
+         it != by_name_.end() && result.size() < limit && it->first.substr(0, prefix.size()) == prefix;
+         ++it)
+        result.push_back(it->second);
+    return result;
+}
+
+const index_symbol* symbol_index::defined_at(const std::string& file, position pos) const
+{
+    auto found = by_definition_.find(definition_key(file, pos.line, pos.column));
+    return found == by_definition_.end() ? nullptr : found->second;
+}
+
+std::vector<index_occurrence> symbol_index::occurrences(const index_symbol& symbol) const
+{
+    std::vector<index_occurrence> result;
+    auto found = symbols_.find(symbol);
+    if (found == symbols_.end())
+        return result;
+
+    for (const auto& [program, occurrences] : found->second)
+        result.insert(result.end(), occurrences.begin(), occurrences.end());
+    // programs share the occurrences in their macros and copy members
+    std::sort(result.begin(), result.end(), occurrence_less);
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+std::vector<std::string> symbol_index::programs(const index_symbol& symbol) const
+{
+    std::vector<std::string> result;
+    if (auto found = symbols_.find(symbol); found != symbols_.end())
+        for (const auto& [program, occurrences] : found->second)
+            result.push_back(program);
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::string> symbol_index::programs_in(const std::string& path) const
+{
+    std::vector<std::string> result;
+    for (const auto& [program, symbols] : programs_)
+    {
+        if (program.compare(0, path.size(), path) != 0)
+            continue;
+        if (program.size() == path.size() || program[path.size()] == '/' || program[path.size()] == '\\')
+            result.push_back(program);
+    }
+    return result;
+}
+
+bool symbol_index::indexed(const std::string& program) const { return programs_.count(program) > 0; }
+
+size_t symbol_index::program_count() const { return programs_.size(); }
+
+size_t symbol_index::symbol_count() const { return symbols_.size(); }
+
+} // namespace hlasm_plugin::parser_library::workspaces
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_SYMBOL_INDEX_H
+#define HLASMPLUGIN_PARSERLIBRARY_SYMBOL_INDEX_H
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "context/hlasm_context.h"
+#include "context/id_storage.h"
+#include "protocol.h"
+
+namespace hlasm_plugin::parser_library::workspaces {
+
+// maximal number of symbols in a response to the workspace/symbol request
+constexpr size_t workspace_symbol_limit = 100;
+
+// Symbol of the index. Symbols of different programs are the same symbol when they are defined at the same place,
+// e.g. a macro from a library or a field of a DSECT in a copy member.
+struct index_symbol
+{
+    workspace_symbol_kind kind;
+    std::string name;
+    // file and range of the definition
+    std::string file;
+    range definition_range;
+
+    bool operator==(const index_symbol& other) const;
+};
+
+struct index_symbol_hash
+{
+    size_t operator()(const index_symbol& symbol) const;
+};
+
+struct index_occurrence
+{
+    // file names are interned by the index, the name is valid as long as the index
+    context::id_index file;
+    range occurrence_range;
+
+    bool operator==(const index_occurrence& other) const;
+};
+
+// Index of macros, copy members, ordinary and sequence symbols of the analyzed programs of a workspace
+// with their occurrences in each program. A program is indexed again after each finished analysis
+// and it stays indexed when it is closed, so its references are found without analyzing it again.
+class symbol_index
+{
+public:
+    // replaces the symbols of the program by the symbols of its latest analysis
+    void update(const std::string& program, context::hlasm_context& ctx);
+    void remove(const std::string& program);
+
+    // symbols whose name starts with the prefix sorted by name, at most limit of them
+    std::vector<const index_symbol*> find(std::string_view prefix, size_t limit) const;
+    // symbol defined at the position, nullptr if there is none
+    const index_symbol* defined_at(const std::string& file, position pos) const;
+    // occurrences of the symbol in all programs without duplicates
+    std::vector<index_occurrence> occurrences(const index_symbol& symbol) const;
+    // programs that use the symbol
+    std::vector<std::string> programs(const index_symbol& symbol) const;
+    // indexed programs that are the path or lie in the directory of the path
+    std::vector<std::string> programs_in(const std::string& path) const;
+    bool indexed(const std::string& program) const;
+
+    size_t program_count() const;
+    size_t symbol_count() const;
+
+private:
+    using program_occurrences = std::unordered_map<std::string, std::vector<index_occurrence>>;
+    using definition_key = std::tuple<std::string_view, position_t, position_t>;
+
+    std::unordered_map<index_symbol, program_occurrences, index_symbol_hash> symbols_;
+    // symbols used by each program
+    std::unordered_map<std::string, std::vector<const index_symbol*>> programs_;
+    // keys point to the symbols stored in symbols_
+    std::multimap<std::string_view, const index_symbol*> by_name_;
+    std::map<definition_key, const index_symbol*> by_definition_;
+    // names of the files with occurrences, there are only a few of them and they are kept for the whole session
+    context::id_storage files_;
+
+    void add_symbol(const std::string& program, index_symbol symbol, std::vector<index_occurrence> occurrences);
+};
+
+} // namespace hlasm_plugin::parser_library::workspaces
+
+#endif // !HLASMPLUGIN_PARSERLIBRARY_SYMBOL_INDEX_H
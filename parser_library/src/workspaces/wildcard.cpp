@@ -14,21 +14,64 @@
 
 #include "wildcard.h"
 
-#include <cassert>
-
 namespace hlasm_plugin::parser_library::workspaces {
 
-std::regex wildcard2regex(const std::string& wildcard)
+wildcard::wildcard(std::string pattern)
 {
-    auto regex_str = wildcard;
+    pattern_.reserve(pattern.size());
+    for (char c : pattern)
+    {
 #ifdef _WIN32
-    // change of forward slash to double backslash on windows
-    regex_str = std::regex_replace(regex_str, slash, "\\");
+        // change of forward slash to backslash on windows
+        if (c == '/')
+            c = '\\';
 #endif
-    regex_str = std::regex_replace(regex_str, escape, "\\$1");
-    regex_str = std::regex_replace(regex_str, question, ".");
-    regex_str = std::regex_replace(regex_str, nongreedy, ".$1?");
-    return std::regex(regex_str);
+        if (c == '+')
+        {
+            pattern_.push_back('?');
+            c = '*';
+        }
+        if (c == '*' && !pattern_.empty() && pattern_.back() == '*')
+            continue;
+        pattern_.push_back(c);
+    }
+}
+
+bool wildcard::match(std::string_view text) const
+{
+    // greedy matching that remembers the last star and backtracks only to it
+    size_t p = 0;
+    size_t t = 0;
+    size_t star_p = std::string::npos;
+    size_t star_t = 0;
+
+    while (t < text.size())
+    {
+        if (p < pattern_.size() && (pattern_[p] == '?' || (pattern_[p] != '*' && pattern_[p] == text[t])))
+        {
+            ++p;
+            ++t;
+        }
+        else if (p < pattern_.size() && pattern_[p] == '*')
+        {
+            star_p = p++;
+            star_t = t;
+        }
+        else if (star_p != std::string::npos)
+        {
+            p = star_p + 1;
+            t = ++star_t;
+        }
+        else
+            return false;
+    }
+
+    while (p < pattern_.size() && pattern_[p] == '*')
+        ++p;
+
+    return p == pattern_.size();
 }
 
-} // namespace hlasm_plugin::parser_library::workspaces
\ No newline at end of file
+bool is_wildcard(std::string_view text) { return text.find_first_of("*+?") != std::string_view::npos; }
+
+} // namespace hlasm_plugin::parser_library::workspaces
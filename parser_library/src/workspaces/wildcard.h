@@ -15,19 +15,32 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_WILDCARD_H
 #define HLASMPLUGIN_PARSERLIBRARY_WILDCARD_H
 
-#include <regex>
+#include <string>
+#include <string_view>
 
 namespace hlasm_plugin::parser_library::workspaces {
 
-// used for wildcard to regex conversions
+// Wildcard pattern prepared for repeated matching against file paths.
+// '*' matches any sequence of characters, '+' any non-empty sequence and '?' any single character,
+// all other characters match literally.
+class wildcard
+{
+public:
+    explicit wildcard(std::string pattern);
 
-static const std::regex escape("(\\(|\\[|\\{|\\\\|\\^|\\-|\\=|\\$|\\!|\\||\\]|\\}|\\)|\\.)");
-static const std::regex question("\\?");
-static const std::regex nongreedy("(\\*|\\+)");
-static const std::regex slash("\\/");
-// Returns a regex that can be used for wildcard matching.
-std::regex wildcard2regex(const std::string& wildcard);
+    // Returns true if the whole text matches the pattern.
+    bool match(std::string_view text) const;
+
+    const std::string& pattern() const { return pattern_; }
+
+private:
+    // normalized pattern, '+' is rewritten to "?*" and consecutive stars are merged
+    std::string pattern_;
+};
+
+// Returns true if the text contains a character that a wildcard pattern does not match literally.
+bool is_wildcard(std::string_view text);
 
 } // namespace hlasm_plugin::parser_library::workspaces
 
-#endif
\ No newline at end of file
+#endif
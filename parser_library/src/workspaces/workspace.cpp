@@ -14,7 +14,9 @@
 
 #include "workspace.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <regex>
 #include <string>
 
@@ -57,32 +59,43 @@ void workspace::collect_diags() const
         add_diagnostic(diag);
 }
 
-void workspace::add_proc_grp(processor_group pg) { proc_grps_.emplace(pg.name(), std::move(pg)); }
-
-bool workspace::program_id_match(const std::string& filename, const program_id& program) const
+void workspace::add_proc_grp(processor_group pg)
 {
-    std::regex prg_regex = wildcard2regex(program);
-    return std::regex_match(filename, prg_regex);
+    proc_grp_by_program_cache_.clear();
+    member_index_.clear();
+    proc_grps_.emplace(pg.name(), std::move(pg));
 }
 
 const processor_group& workspace::get_proc_grp_by_program(const std::string& filename) const
 {
     assert(opened_);
 
+    if (auto cached = proc_grp_by_program_cache_.find(filename); cached != proc_grp_by_program_cache_.end())
+        return cached->second ? *cached->second : implicit_proc_grp;
+
     std::filesystem::path fname_path(filename);
     std::string file = fname_path.lexically_relative(uri_).lexically_normal().string();
 
-    // direct match
-    auto program = exact_pgm_conf_.find(file);
-    if (program != exact_pgm_conf_.cend())
-        return proc_grps_.at(program->second.pgroup);
+    // nullptr stands for the implicit processor group, which moves together with the workspace
+    const processor_group* result = nullptr;
 
-    for (const auto& pgm : regex_pgm_conf_)
+    // direct match
+    if (auto program = exact_pgm_conf_.find(file); program != exact_pgm_conf_.cend())
+        result = &proc_grps_.at(program->second.pgroup);
+    else
     {
-        if (std::regex_match(file, pgm.second))
-            return proc_grps_.at(pgm.first.pgroup);
+        for (const auto& pgm : wildcard_pgm_conf_)
+        {
+            if (pgm.second.match(file))
+            {
+                result = &proc_grps_.at(pgm.first.pgroup);
+                break;
+            }
+        }
     }
-    return implicit_proc_grp;
+
+    proc_grp_by_program_cache_.emplace(filename, result);
+    return result ? *result : implicit_proc_grp;
 }
 
 const ws_uri& workspace::uri() { return uri_; }
@@ -95,19 +108,14 @@ void workspace::parse_file(const std::string& file_uri)
     {
         if (load_config())
         {
+            std::vector<processor_file_ptr> files_to_parse;
             for (auto fname : dependants_)
             {
                 auto found = file_manager_.find_processor_file(fname);
                 if (found)
-                    found->parse(*this);
-            }
-
-            for (auto fname : dependants_)
-            {
-                auto found = file_manager_.find_processor_file(fname);
-                if (found)
-                    filter_and_close_dependencies_(found->files_to_close(), found);
+                    files_to_parse.push_back(found);
             }
+            parse_files_(std::move(files_to_parse));
         }
 
         return;
@@ -137,30 +145,121 @@ void workspace::parse_file(const std::string& file_uri)
             files_to_parse.push_back(f);
     }
 
-    for (auto f : files_to_parse)
+    parse_files_(std::move(files_to_parse));
+}
+
+void workspace::restore_file(const std::string& file_uri)
+{
+    auto file = file_manager_.find_processor_file(file_uri);
+    if (!file || file->resident())
+        return;
+
+    // a dependency has no state of its own, it is analyzed as a part of the first program that uses it
+    for (const auto& fname : dependants_)
     {
-        f->parse(*this);
+        auto f = file_manager_.find_processor_file(fname);
+        if (f && f->dependencies().count(file_uri))
+        {
+            parse_and_index_(f);
+            return;
+        }
+    }
+
+    parse_and_index_(file);
+}
+
+void workspace::parse_files_(std::vector<processor_file_ptr> files)
+{
+    // the file the user works with goes first, then the other files open in the editor and background dependants last
+    auto open_files = std::stable_partition(
+        files.begin(), files.end(), [this](const auto& f) { return f->get_file_name() == active_file_; });
+    std::stable_partition(open_files, files.end(), [](const auto& f) { return f->get_lsp_editing(); });
+    if (background_analysis_)
+    {
+        // only the active file is analyzed right away, the others wait for the background analysis in the same order
+        for (auto it = open_files; it != files.end(); ++it)
+            if (std::find(background_files_.begin(), background_files_.end(), (*it)->get_file_name())
+                == background_files_.end())
+                background_files_.push_back((*it)->get_file_name());
+        files.erase(open_files, files.end());
+    }
+
+    for (auto f : files)
+    {
+        background_files_.erase(
+            std::remove(background_files_.begin(), background_files_.end(), f->get_file_name()),
+            background_files_.end());
+        // the analysis preempted by a request about another file is finished by the background analysis
+        if (!parse_and_index_(f) && background_analysis_)
+            background_files_.push_back(f->get_file_name());
         if (!f->dependencies().empty())
             dependants_.insert(f->get_file_name());
     }
 
     // second check after all dependants are there to close all files that used to be dependencies
-    for (auto f : files_to_parse)
+    for (auto f : files)
         filter_and_close_dependencies_(f->files_to_close(), f);
 }
 
-void workspace::refresh_libraries()
+parse_result workspace::parse_and_index_(processor_file_ptr file)
 {
-    for (auto& proc_grp : proc_grps_)
+    auto result = file->parse(*this, analyzer_options_);
+    if (result)
+        if (auto ctx = file->analysis_context())
+            symbol_index_.update(file->get_file_name(), *ctx);
+    return result;
+}
+
+const symbol_index& workspace::get_symbol_index() const { return symbol_index_; }
+
+bool workspace::index_step(const std::atomic<bool>* cancel)
+{
+    if (cancel && *cancel)
+        return true;
+
+    while (!index_programs_.empty())
     {
-        for (auto& lib : proc_grp.second.libraries())
+        const auto& program = index_programs_.back();
+        // programs known to the file manager are indexed by their own analysis
+        if (symbol_index_.indexed(program) || file_manager_.find_processor_file(program)
+            || !file_manager_.file_exists(program))
         {
-            lib->refresh();
+            index_programs_.pop_back();
+            continue;
         }
+
+        auto file = file_manager_.add_processor_file(program);
+        bool done = file->update_and_get_bad() || parse_and_index_(file);
+        // only the symbols of the program are kept
+        filter_and_close_dependencies_(file->dependencies(), file);
+        file_manager_.remove_file(program);
+        if (done)
+            index_programs_.pop_back();
+        return true;
     }
+    return false;
 }
 
-void workspace::did_open_file(const std::string& file_uri) { parse_file(file_uri); }
+void workspace::remove_deleted_programs_(const std::string& path)
+{
+    for (const auto& program : symbol_index_.programs_in(path))
+        if (!file_manager_.file_exists(program))
+            symbol_index_.remove(program);
+}
+
+void workspace::refresh_libraries()
+{
+    member_index_.clear();
+    for (auto& proc_grp : proc_grps_)
+        proc_grp.second.refresh_libraries();
+    start_warm_up();
+}
+
+void workspace::did_open_file(const std::string& file_uri)
+{
+    active_file_ = file_uri;
+    parse_file(file_uri);
+}
 
 void workspace::did_close_file(const std::string& file_uri)
 {
@@ -183,22 +282,202 @@ void workspace::did_close_file(const std::string& file_uri)
         dependants_.erase(fname);
     }
 
+    background_files_.erase(
+        std::remove(background_files_.begin(), background_files_.end(), file_uri), background_files_.end());
+    if (active_file_ == file_uri)
+        active_file_.clear();
+
     // close the file itself
     file_manager_.did_close_file(file_uri);
     file_manager_.remove_file(file_uri);
 }
 
-void workspace::did_change_file(const std::string file_uri, const document_change*, size_t) { parse_file(file_uri); }
+void workspace::did_change_file(const std::string file_uri, const document_change*, size_t)
+{
+    active_file_ = file_uri;
+    parse_file(file_uri);
+}
 
 void workspace::did_change_watched_files(const std::string& file_uri)
 {
-    refresh_libraries();
+    if (changes_library_directories_(file_uri))
+        refresh_libraries();
+    else
+    {
+        for (auto& proc_grp : proc_grps_)
+            for (const auto& member : proc_grp.second.refresh_libraries(file_uri))
+                member_index_.erase(member);
+    }
+    remove_deleted_programs_(file_uri);
     parse_file(file_uri);
 }
 
+bool workspace::changes_library_directories_(const std::string& path)
+{
+    // a created, deleted or renamed directory may be a library or contain one, its members are not known
+    if (file_manager_.dir_exists(path))
+        return true;
+    return std::any_of(proc_grps_.begin(), proc_grps_.end(), [&path](const auto& proc_grp) {
+        return proc_grp.second.has_library_directory(path);
+    });
+}
+
+library* workspace::find_library_(const processor_group& proc_grp, const std::string& member) const
+{
+    auto& entries = member_index_[member];
+    for (const auto& [name, lib] : entries)
+        if (name == proc_grp.name())
+            return lib;
+
+    library* found = nullptr;
+    for (auto&& lib : proc_grp.libraries())
+    {
+        if (lib->has_file(member))
+        {
+            found = lib.get();
+            break;
+        }
+    }
+    entries.emplace_back(proc_grp.name(), found);
+    return found;
+}
+
 void workspace::open() { load_config(); }
 
-void workspace::close() { opened_ = false; }
+void workspace::close()
+{
+    opened_ = false;
+    if (member_usage_unsaved_ > 0)
+        save_member_usage_();
+}
+
+void workspace::set_background_analysis(bool enabled) { background_analysis_ = enabled; }
+
+void workspace::set_analyzer_options(analyzer_options options) { analyzer_options_ = options; }
+
+bool workspace::background_analysis_step()
+{
+    if (background_files_.empty())
+        return false;
+
+    auto fname = background_files_.front();
+    auto f = file_manager_.find_processor_file(fname);
+    if (!f)
+    {
+        background_files_.erase(background_files_.begin());
+        return true;
+    }
+
+    // a preempted analysis leaves the file waiting for the next step
+    if (!parse_and_index_(f))
+        return true;
+
+    background_files_.erase(background_files_.begin());
+    if (!f->dependencies().empty())
+        dependants_.insert(fname);
+    filter_and_close_dependencies_(f->files_to_close(), f);
+    return true;
+}
+
+bool workspace::warm_up_step(const std::atomic<bool>* cancel)
+{
+    if (cancel && *cancel)
+        return true;
+
+    if (member_usage_unsaved_ >= MEMBER_USAGE_SAVE_BATCH)
+    {
+        save_member_usage_();
+        return true;
+    }
+
+    if (!warm_up_libraries_.empty())
+    {
+        auto lib = warm_up_libraries_.back();
+        warm_up_libraries_.pop_back();
+        lib->prefetch();
+        return true;
+    }
+
+    if (!warm_up_members_selected_)
+    {
+        warm_up_members_ = most_used_members();
+        warm_up_members_selected_ = true;
+        return !warm_up_members_.empty();
+    }
+
+    if (warm_up_members_.empty())
+        return false;
+
+    if (!file_manager_.prefetch_file(warm_up_members_.back(), cancel))
+        return true;
+    warm_up_members_.pop_back();
+    return !warm_up_members_.empty();
+}
+
+void workspace::set_member_usage_file(std::filesystem::path file)
+{
+    member_usage_file_ = std::move(file);
+
+    std::ifstream fin(member_usage_file_);
+    if (!fin)
+        return;
+    try
+    {
+        auto usage = nlohmann::json::parse(fin);
+        for (const auto& [member, count] : usage.items())
+            if (count.is_number_unsigned())
+                member_usage_[member] += count.get<size_t>();
+    }
+    catch (const nlohmann::json::exception&)
+    {
+        // the usage is only a hint, a damaged file is overwritten by the next save
+    }
+}
+
+void workspace::save_member_usage_()
+{
+    member_usage_unsaved_ = 0;
+    if (member_usage_file_.empty())
+        return;
+
+    std::error_code ec;
+    std::filesystem::create_directories(member_usage_file_.parent_path(), ec);
+    std::ofstream fout(member_usage_file_);
+    if (fout)
+        fout << nlohmann::json(member_usage_);
+}
+
+void workspace::start_warm_up()
+{
+    warm_up_libraries_.clear();
+    for (const auto& [name, proc_grp] : proc_grps_)
+        for (const auto& lib : proc_grp.libraries())
+            warm_up_libraries_.push_back(lib.get());
+    // the libraries are taken from the back, in the order in which the processor groups list them
+    std::reverse(warm_up_libraries_.begin(), warm_up_libraries_.end());
+
+    warm_up_members_.clear();
+    warm_up_members_selected_ = false;
+}
+
+std::vector<std::string> workspace::most_used_members() const
+{
+    std::vector<std::pair<size_t, const std::string*>> usage;
+    usage.reserve(member_usage_.size());
+    for (const auto& [file, count] : member_usage_)
+        usage.emplace_back(count, &file);
+
+    auto selected = std::min(usage.size(), WARM_UP_MEMBERS);
+    std::partial_sort(usage.begin(), usage.begin() + selected, usage.end(), [](const auto& l, const auto& r) {
+        return l.first > r.first || (l.first == r.first && *l.second < *r.second);
+    });
+
+    // the members are taken from the back, so the most used one is last
+    std::vector<std::string> result;
+    for (size_t i = selected; i > 0; --i)
+        result.push_back(*usage[i - 1].second);
+    return result;
+}
 
 file_manager& workspace::get_file_manager() { return file_manager_; }
 
@@ -212,6 +491,9 @@ const processor_group& workspace::get_proc_grp(const proc_grp_id& proc_grp) cons
 bool workspace::load_config()
 {
     config_diags_.clear();
+    proc_grp_by_program_cache_.clear();
+    // the libraries may be replaced
+    warm_up_libraries_.clear();
 
     opened_ = true;
 
@@ -229,6 +511,7 @@ bool workspace::load_config()
     {
         proc_grps_json = nlohmann::json::parse(proc_grps_file->get_text());
         proc_grps_.clear();
+        member_index_.clear();
     }
     catch (const nlohmann::json::exception&)
     {
@@ -249,7 +532,7 @@ bool workspace::load_config()
     {
         pgm_conf_json = nlohmann::json::parse(pgm_conf_file->get_text());
         exact_pgm_conf_.clear();
-        regex_pgm_conf_.clear();
+        wildcard_pgm_conf_.clear();
     }
     catch (const nlohmann::json::exception&)
     {
@@ -258,18 +541,18 @@ bool workspace::load_config()
     }
 
     // get extensions from pgm conf
-    extension_regex_map extensions;
+    extension_wildcard_map extensions;
     std::regex extension_regex("^(.*\\*)(\\.\\w+)$");
     json wildcards = pgm_conf_json["alwaysRecognize"];
-    for (const auto& wildcard : wildcards)
+    for (const auto& wildcard_json : wildcards)
     {
-        std::string wildcard_str = wildcard.get<std::string>();
+        std::string wildcard_str = wildcard_json.get<std::string>();
         // extension wildcard
         if (std::regex_match(wildcard_str, extension_regex))
             extensions.insert({ std::regex_replace(wildcard_str, extension_regex, "$2"),
-                wildcard2regex((ws_path / wildcard_str).string()) });
+                wildcard((ws_path / wildcard_str).string()) });
     }
-    auto extensions_ptr = std::make_shared<const extension_regex_map>(std::move(extensions));
+    auto extensions_ptr = std::make_shared<const extension_wildcard_map>(std::move(extensions));
     // process processor groups
     json pgs = proc_grps_json["pgroups"];
     for (auto& pg : pgs)
@@ -309,13 +592,13 @@ bool workspace::load_config()
         if (proc_grps_.find(pgroup) != proc_grps_.end())
         {
 #ifdef _WIN32
-            // change of forward slash to double backslash on windows
-            pgm_name = std::regex_replace(pgm_name, slash, "\\");
+            // change of forward slash to backslash on windows
+            std::replace(pgm_name.begin(), pgm_name.end(), '/', '\\');
 #endif
             if (!is_wildcard(pgm_name))
                 exact_pgm_conf_.emplace(pgm_name, program { pgm_name, pgroup });
             else
-                regex_pgm_conf_.push_back({ program { pgm_name, pgroup }, wildcard2regex(pgm_name) });
+                wildcard_pgm_conf_.push_back({ program { pgm_name, pgroup }, wildcard(pgm_name) });
         }
         else
         {
@@ -323,13 +606,15 @@ bool workspace::load_config()
         }
     }
 
+    start_warm_up();
+
+    // programs of the configuration are indexed in the background, so their references are known before they are open
+    index_programs_.clear();
+    for (const auto& [name, pgm] : exact_pgm_conf_)
+        index_programs_.push_back((ws_path_ / name).string());
+
     return true;
 }
-bool workspace::is_wildcard(const std::string& str)
-{
-    return str.find('*') != std::string::npos || str.find('?') != std::string::npos;
-}
-
 void workspace::filter_and_close_dependencies_(const std::set<std::string>& dependencies, processor_file_ptr file)
 {
     std::set<std::string> filtered;
@@ -381,12 +666,20 @@ bool workspace::is_dependency_(const std::string& file_uri)
 parse_result workspace::parse_library(
     const std::string& library, context::hlasm_context& hlasm_ctx, const library_data data)
 {
-    auto& proc_grp = get_proc_grp_by_program(hlasm_ctx.opencode_file_name());
-    for (auto&& lib : proc_grp.libraries())
+    auto lib = find_library_(get_proc_grp_by_program(hlasm_ctx.opencode_file_name()), library);
+    if (!lib)
+        return false;
+
+    std::shared_ptr<processor> found = lib->find_file(library);
+    if (found)
     {
-        std::shared_ptr<processor> found = lib->find_file(library);
-        if (found)
-            return found->parse_macro(*this, hlasm_ctx, data);
+        if (auto file = std::dynamic_pointer_cast<processor_file>(found))
+        {
+            ++member_usage_[file->get_file_name()];
+            if (!member_usage_file_.empty())
+                ++member_usage_unsaved_;
+        }
+        return found->parse_macro(*this, hlasm_ctx, data);
     }
 
     return false;
@@ -394,15 +687,7 @@ parse_result workspace::parse_library(
 
 bool workspace::has_library(const std::string& library, context::hlasm_context& hlasm_ctx) const
 {
-    auto& proc_grp = get_proc_grp_by_program(hlasm_ctx.opencode_file_name());
-    for (auto&& lib : proc_grp.libraries())
-    {
-        std::shared_ptr<processor> found = lib->find_file(library);
-        if (found)
-            return true;
-    }
-
-    return false;
+    return find_library_(get_proc_grp_by_program(hlasm_ctx.opencode_file_name()), library) != nullptr;
 }
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -15,6 +15,7 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_H
 #define HLASMPLUGIN_PARSERLIBRARY_WORKSPACE_H
 
+#include <atomic>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -26,6 +27,8 @@
 #include "library.h"
 #include "processor.h"
 #include "processor_group.h"
+#include "symbol_index.h"
+#include "wildcard.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
 
@@ -73,6 +76,8 @@ public:
     const processor_group& get_proc_grp_by_program(const std::string& program) const;
 
     void parse_file(const std::string& file_uri);
+    // rebuilds the analyzer state of an evicted file without reparsing all dependants of the file
+    void restore_file(const std::string& file_uri);
     void refresh_libraries();
     void did_open_file(const std::string& file_uri);
     void did_close_file(const std::string& file_uri);
@@ -88,6 +93,36 @@ public:
     void open();
     void close();
 
+    // when enabled, parse_file analyzes only the active file right away, the other dependants of the changed file
+    // wait for background_analysis_step, so does the active file when its analysis is preempted, disabled by default
+    void set_background_analysis(bool enabled);
+    // analyzes one of the dependants waiting for the background analysis
+    // an analysis preempted by the cancellation token is repeated by a later step
+    // returns false when no file was waiting
+    bool background_analysis_step();
+
+    // symbols of the programs analyzed in the workspace
+    const symbol_index& get_symbol_index() const;
+    // indexes one of the programs of the configuration that were not analyzed yet, so their symbols are known
+    // before they are opened, the program is not kept open afterwards
+    // a step stopped by the cancellation token is repeated by the next one
+    // returns false when there is nothing left to do
+    bool index_step(const std::atomic<bool>* cancel = nullptr);
+
+    // performs one step of the warm-up, which lists the library directories and reads ahead the library members used
+    // most often, the warm-up is started again whenever the libraries are reloaded
+    // each step touches one directory or file, so callers can interleave the steps with requests
+    // a step stopped by the cancellation token is repeated by the next one
+    // returns false when there is nothing left to do
+    bool warm_up_step(const std::atomic<bool>* cancel = nullptr);
+
+    // options of the analyses of the programs in the workspace, they apply from the next analysis of each program
+    void set_analyzer_options(analyzer_options options);
+
+    // the member usage is loaded from the file and stored back into it by the warm-up when it changes,
+    // so the most used members are known from the start of the next session
+    void set_member_usage_file(std::filesystem::path file);
+
 protected:
     file_manager& get_file_manager();
 
@@ -102,8 +137,18 @@ private:
 
     std::unordered_map<proc_grp_id, processor_group> proc_grps_;
     std::map<std::string, program> exact_pgm_conf_;
-    std::vector<std::pair<program, std::regex>> regex_pgm_conf_;
+    std::vector<std::pair<program, wildcard>> wildcard_pgm_conf_;
     processor_group implicit_proc_grp;
+    // processor groups already resolved for open code files, cleared when the configuration is reloaded
+    // nullptr stands for implicit_proc_grp
+    mutable std::unordered_map<std::string, const processor_group*> proc_grp_by_program_cache_;
+
+    // member name => first library containing it for each processor group that looked the member up,
+    // nullptr caches members not found in any library of the group
+    mutable std::unordered_map<std::string, std::vector<std::pair<proc_grp_id, library*>>> member_index_;
+    library* find_library_(const processor_group& proc_grp, const std::string& member) const;
+    // checks whether the change of the path may add or remove whole library directories
+    bool changes_library_directories_(const std::string& path);
 
     std::filesystem::path ws_path_;
     std::filesystem::path proc_grps_path_;
@@ -111,19 +156,53 @@ private:
 
     bool opened_ = false;
 
-    bool load_config();
+    // the warm-up loads at most this number of the most used members
+    constexpr static size_t WARM_UP_MEMBERS = 64;
+
+    // libraries waiting to be listed by the warm-up
+    std::vector<library*> warm_up_libraries_;
+    // files of members waiting to be loaded by the warm-up, selected once the libraries are listed
+    std::vector<std::string> warm_up_members_;
+    bool warm_up_members_selected_ = true;
+    // number of times each library member file was used by the programs of the workspace
+    std::unordered_map<std::string, size_t> member_usage_;
+    std::filesystem::path member_usage_file_;
+    // uses not saved yet, the idle work saves them in batches of MEMBER_USAGE_SAVE_BATCH, the rest is saved at close
+    size_t member_usage_unsaved_ = 0;
+    constexpr static size_t MEMBER_USAGE_SAVE_BATCH = 256;
+    void save_member_usage_();
+
+    void start_warm_up();
+    std::vector<std::string> most_used_members() const;
 
-    bool is_wildcard(const std::string& str);
+    bool load_config();
 
     // files, that depend on others (e.g. open code files that use macros)
     std::set<std::string> dependants_;
 
+    // the file most recently opened or changed in the editor, its analysis goes before the other files
+    std::string active_file_;
+    bool background_analysis_ = false;
+    // dependants waiting for the background analysis in the order of their analysis
+    std::vector<std::string> background_files_;
+
+    // analyzes the files, the active file first, then the other open files and the background dependants
+    void parse_files_(std::vector<processor_file_ptr> files);
+
+    analyzer_options analyzer_options_;
+
+    symbol_index symbol_index_;
+    // programs of the configuration waiting for index_step
+    std::vector<std::string> index_programs_;
+    // deleted or renamed programs, directly or with their directory, are removed from the index
+    void remove_deleted_programs_(const std::string& path);
+    // analyzes the file and indexes its symbols unless the analysis was preempted
+    parse_result parse_and_index_(processor_file_ptr file);
+
     diagnostic_container config_diags_;
 
     void filter_and_close_dependencies_(const std::set<std::string>& dependencies, processor_file_ptr file);
     bool is_dependency_(const std::string& file_uri);
-
-    bool program_id_match(const std::string& filename, const program_id& program) const;
 };
 
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -63,6 +63,32 @@ TEST(context_id_storage, case_insensitive)
     ASSERT_TRUE(it1 == it3);
 }
 
+TEST(context_id_storage, scratch)
+{
+    hlasm_context ctx;
+
+    auto permanent = ctx.ids().add("var");
+    auto size = ctx.ids().size();
+
+    // stored names are not duplicated
+    EXPECT_EQ(ctx.ids().add_scratch("VAR"), permanent);
+    EXPECT_FALSE(ctx.ids().is_scratch(permanent));
+
+    auto scratch = ctx.ids().add_scratch("gen1");
+    EXPECT_TRUE(ctx.ids().is_scratch(scratch));
+    EXPECT_EQ(*scratch, "GEN1");
+    EXPECT_EQ(ctx.ids().add_scratch("GEN1"), scratch);
+    EXPECT_EQ(ctx.ids().find("GEN1"), nullptr);
+    EXPECT_EQ(ctx.ids().size(), size);
+    EXPECT_EQ(ctx.ids().scratch_size(), (size_t)1);
+
+    ctx.ids().add_scratch("gen2");
+    ctx.ids().release_scratch();
+    EXPECT_EQ(ctx.ids().scratch_size(), (size_t)0);
+    EXPECT_EQ(ctx.ids().size(), size);
+    EXPECT_EQ(ctx.ids().peak_size(), size + 2);
+}
+
 TEST(context, create_global_var)
 {
     hlasm_context ctx;
@@ -175,6 +201,71 @@ TEST(context_set_vars, set_non_scalar)
     EXPECT_EQ(var.get_value(1000), "");
 }
 
+TEST(context_set_vars, dense_and_sparse_storage)
+{
+    hlasm_context ctx;
+
+    auto idx = ctx.ids().add("var");
+
+    set_symbol<A_t> var(idx, false, false);
+
+    for (size_t i = 0; i < 5000; ++i)
+        var.set_value((A_t)i, i);
+
+    EXPECT_EQ(var.size(), 5000U);
+    EXPECT_EQ(var.number(), 5000);
+    EXPECT_EQ(var.get_value(4999), 4999);
+    EXPECT_EQ(var.count({ 5000 }), 4);
+    EXPECT_EQ(var.keys(4998, 10), (std::vector<size_t> { 4998, 4999 }));
+
+    // far index switches the storage to sparse representation
+    var.set_value(7, 100000000);
+
+    EXPECT_EQ(var.size(), 5001U);
+    EXPECT_EQ(var.number(), 100000001);
+    EXPECT_EQ(var.get_value(100000000), 7);
+    EXPECT_EQ(var.get_value(4999), 4999);
+    EXPECT_EQ(var.get_value(5000), 0);
+
+    auto keys = var.keys();
+    ASSERT_EQ(keys.size(), 5001U);
+    EXPECT_EQ(keys.front(), 0U);
+    EXPECT_EQ(keys[4999], 4999U);
+    EXPECT_EQ(keys.back(), 100000000U);
+    EXPECT_EQ(var.keys(4999, 10), (std::vector<size_t> { 4999, 100000000 }));
+    EXPECT_TRUE(var.keys(5001, 10).empty());
+}
+
+TEST(context_set_vars, shared_string_values)
+{
+    hlasm_context ctx;
+
+    auto idx = ctx.ids().add("var");
+
+    set_symbol<C_t> var(idx, true, false);
+    const C_t long_value(100, 'X');
+    var.set_value(long_value);
+
+    // the value read from the symbol shares its buffer
+    SET_t value(var.get_stored_value());
+    EXPECT_EQ(&value.access_c(), &var.get_value());
+
+    // shared buffer is copied when the value is taken
+    EXPECT_EQ(value.take_c(), long_value);
+    EXPECT_EQ(var.get_value(), long_value);
+
+    // buffer that is not shared is moved out
+    SET_t unique(long_value);
+    auto data = unique.access_c().data();
+    EXPECT_EQ(unique.take_c().data(), data);
+
+    // values of other types carry no string
+    SET_t number(5);
+    EXPECT_EQ(number.access_a(), 5);
+    EXPECT_EQ(number.access_c(), "");
+    EXPECT_FALSE(number.access_b());
+}
+
 
 TEST(context_macro_param, param_data)
 {
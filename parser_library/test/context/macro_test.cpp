@@ -685,3 +685,63 @@ TEST(macro, parse_args)
     EXPECT_EQ(a.diags().size(), (size_t)0);
     EXPECT_EQ(a.parser().getNumberOfSyntaxErrors(), (size_t)0);
 }
+
+TEST(macro, repeated_expansion_with_variable_opcode)
+{
+    std::string input =
+        R"(
+         MACRO
+&L       M     &OP,&V
+&L       &OP   &V
+         MEND
+
+A        M     EQU,1
+B        M     EQU,2
+C        M     DC,F'1'
+D        M     EQU,3
+E        M     DC,H'1'
+)";
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+
+    EXPECT_EQ(a.diags().size(), (size_t)0);
+
+    auto& ctx = a.context();
+    EXPECT_EQ(ctx.ord_ctx.get_symbol(ctx.ids().add("A"))->value().get_abs(), 1);
+    EXPECT_EQ(ctx.ord_ctx.get_symbol(ctx.ids().add("B"))->value().get_abs(), 2);
+    EXPECT_EQ(ctx.ord_ctx.get_symbol(ctx.ids().add("D"))->value().get_abs(), 3);
+    EXPECT_EQ(ctx.ord_ctx.get_symbol(ctx.ids().add("C"))->attributes().length(), (symbol_attributes::len_attr)4);
+    EXPECT_EQ(ctx.ord_ctx.get_symbol(ctx.ids().add("E"))->attributes().length(), (symbol_attributes::len_attr)2);
+}
+
+TEST(macro, repeated_expansion_with_unknown_opcode)
+{
+    std::string input =
+        R"(
+         MACRO
+&L       M     &OP,&V
+&L       &OP   &V
+         MEND
+
+A        M     XYZ1,1
+B        M     XYZ2,1
+C        M     EQU,1
+D        M     XYZ1,1
+)";
+    analyzer a(input);
+    a.analyze();
+    a.collect_diags();
+
+    // generated names of unknown instructions are not reused between expansions
+    ASSERT_EQ(a.diags().size(), (size_t)3);
+    auto mentions = [&a](const std::string& name) {
+        return std::count_if(a.diags().begin(), a.diags().end(), [&name](const diagnostic_s& d) {
+            return d.message.find(name) != std::string::npos;
+        });
+    };
+    EXPECT_EQ(mentions("XYZ1"), 2);
+    EXPECT_EQ(mentions("XYZ2"), 1);
+    auto& ctx = a.context();
+    EXPECT_EQ(ctx.ord_ctx.get_symbol(ctx.ids().add("C"))->value().get_abs(), 1);
+}
@@ -987,3 +987,34 @@ X EQU 2
     a.collect_diags();
     ASSERT_EQ(a.diags().size(), (size_t)0);
 }
+
+TEST(org, overlay_with_unknown_lengths)
+{
+    std::string input(R"(
+D  DSECT
+F0 DS  XL(L0)
+F1 DS  XL(L1)
+F2 DS  XL(L2)
+F3 DS  XL(L3)
+E  EQU *
+   ORG F1
+O  DS  A
+   ORG E
+X  EQU E-F0
+Y  EQU O-F0
+Z  EQU E-O
+L0 EQU 1
+L1 EQU 2
+L2 EQU 3
+L3 EQU 4
+)");
+    analyzer a(input);
+    a.analyze();
+
+    a.collect_diags();
+    EXPECT_EQ(a.diags().size(), (size_t)0);
+
+    EXPECT_EQ(a.context().ord_ctx.get_symbol(a.context().ids().add("X"))->value().get_abs(), 10);
+    EXPECT_EQ(a.context().ord_ctx.get_symbol(a.context().ids().add("Y"))->value().get_abs(), 1);
+    EXPECT_EQ(a.context().ord_ctx.get_symbol(a.context().ids().add("Z"))->value().get_abs(), 9);
+}
@@ -405,6 +405,55 @@ TEST(debugger, var_symbol_array)
     m.wait_for_exited();
 }
 
+TEST(debugger, var_symbol_array_paging)
+{
+    std::string open_code = R"(
+&VARP(30) SETA 1,456,48,7
+ LR 1,1
+)";
+
+    file_manager_impl file_manager;
+    workspace_mock lib_provider(file_manager);
+    debug_event_consumer_s_mock m;
+    debug_config cfg;
+    debugger d(m, cfg);
+    std::string filename = "ws\\test";
+    file_manager.did_open_file(filename, 0, open_code);
+
+    d.launch(file_manager.find_processor_file(filename), lib_provider, true);
+    m.wait_for_stopped();
+    d.next();
+    m.wait_for_stopped();
+
+    auto frames = d.stack_frames();
+    ASSERT_EQ(frames.size(), 1U);
+    auto& sc = d.scopes(frames.at(0).id);
+    ASSERT_EQ(sc.size(), 3U);
+    auto& locs = d.variables(sc.at(1).var_reference);
+    ASSERT_EQ(locs.size(), 1U);
+    const auto& varp = *locs.at(0);
+    EXPECT_EQ(varp.get_name(), "VARP");
+    EXPECT_TRUE(varp.is_indexed());
+    EXPECT_EQ(varp.size(), 4U);
+
+    auto& page = d.variables(varp.var_reference, 1, 2);
+    ASSERT_EQ(page.size(), 2U);
+    EXPECT_EQ(page[0]->get_name(), "31");
+    EXPECT_EQ(page[0]->get_value(), "456");
+    EXPECT_EQ(page[1]->get_name(), "32");
+    EXPECT_EQ(page[1]->get_value(), "48");
+
+    auto& last_page = d.variables(varp.var_reference, 3, 10);
+    ASSERT_EQ(last_page.size(), 1U);
+    EXPECT_EQ(last_page[0]->get_name(), "33");
+
+    EXPECT_EQ(d.variables(varp.var_reference, 4, 10).size(), 0U);
+    EXPECT_EQ(d.variables(varp.var_reference).size(), 4U);
+
+    d.next();
+    m.wait_for_exited();
+}
+
 TEST(debugger, ordinary)
 {
     using list = std::unordered_map<std::string, std::shared_ptr<test_var_value>>;
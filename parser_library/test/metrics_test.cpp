@@ -155,3 +155,123 @@ TEST_F(benchmark_test, lookahead_statements)
     // 2 lines skipped by lookahead + 1 which finds the symbol
     EXPECT_EQ(a->get_metrics().lookahead_statements, (size_t)3);
 }
+
+TEST_F(benchmark_test, token_buffer)
+{
+    std::string input = R"(
+&I       SETA  0
+.LOOP    ANOP
+&I       SETA  &I+1
+         AIF   (&I LT 10).LOOP
+         AGO   .SKIP
+         LR    1,1
+.SKIP    ANOP
+)";
+    const size_t lines = 100000;
+    for (size_t i = 0; i < lines; ++i)
+        input.append(" LR 1,1\n");
+
+    setUpAnalyzer(input);
+    a->collect_diags();
+    EXPECT_EQ(a->diags().size(), (size_t)0);
+
+    const auto& metrics = a->get_metrics();
+    RecordProperty("token_buffer_peak", (int)metrics.token_buffer_peak);
+    RecordProperty("retained_tokens", (int)metrics.retained_tokens);
+
+    // only the tokens of the statement being parsed are buffered
+    EXPECT_GT(metrics.token_buffer_peak, (size_t)0);
+    EXPECT_LT(metrics.token_buffer_peak, (size_t)100);
+    EXPECT_EQ(metrics.retained_tokens, (size_t)0);
+}
+
+TEST_F(benchmark_test, retained_tokens)
+{
+    // subscripts in the label field are parse trees that refer to the tokens of the statement
+    setUpAnalyzer(R"(
+         MACRO
+         M
+&A(1)    SETA  1
+&A(2)    SETA  &A(1)+1
+         MEND
+         M
+         M
+)");
+    a->collect_diags();
+    EXPECT_EQ(a->diags().size(), (size_t)0);
+    EXPECT_GT(a->get_metrics().retained_tokens, (size_t)0);
+}
+
+TEST_F(benchmark_test, phase_times)
+{
+    setUpAnalyzer(" MAC 1\n COPY COPYFILE\n LR 1,X\nX EQU 1");
+
+    const auto& metrics = a->get_metrics();
+    EXPECT_GT(metrics.lexing_time, (size_t)0);
+    EXPECT_GT(metrics.parsing_time, (size_t)0);
+    EXPECT_GT(metrics.reparsing_time, (size_t)0);
+    EXPECT_GT(metrics.processing_time, (size_t)0);
+    EXPECT_GT(metrics.library_time, (size_t)0);
+    EXPECT_GT(metrics.postponed_checking_time, (size_t)0);
+    // MAC and COPYFILE are looked up once each
+    EXPECT_EQ(metrics.library_lookups, (size_t)2);
+    // LR refers to X defined later
+    EXPECT_GT(metrics.postponed_statements, (size_t)0);
+    EXPECT_EQ(metrics.lookaheads, (size_t)0);
+}
+
+TEST_F(benchmark_test, lookaheads)
+{
+    setUpAnalyzer(" AGO .HERE\n something\n.HERE ANOP\n AGO .THERE\n.THERE ANOP");
+
+    const auto& metrics = a->get_metrics();
+    // each AGO to a sequence symbol not yet defined starts a lookahead
+    EXPECT_EQ(metrics.lookaheads, (size_t)2);
+    EXPECT_GT(metrics.lookahead_time, (size_t)0);
+    EXPECT_GT(metrics.ca_evaluation_time, (size_t)0);
+}
+
+TEST_F(benchmark_test, generated_identifiers)
+{
+    // created variable symbols that were never defined and generated unknown instructions are not stored permanently
+    auto source = [](int count) {
+        return R"(
+&I       SETA  0
+.LOOP    ANOP
+&I       SETA  &I+1
+&V       SETA  &(UNDEFINED&I)
+         INSTR&I
+         AIF   (&I LT )"
+            + std::to_string(count) + ").LOOP\n";
+    };
+
+    // no library provides the generated instructions
+    analyzer short_analyzer(source(10));
+    short_analyzer.analyze();
+    auto short_loop = short_analyzer.get_metrics();
+    analyzer long_analyzer(source(100));
+    long_analyzer.analyze();
+    auto long_loop = long_analyzer.get_metrics();
+
+    EXPECT_EQ(short_loop.identifiers, long_loop.identifiers);
+    EXPECT_EQ(short_loop.identifier_memory, long_loop.identifier_memory);
+    EXPECT_GT(long_loop.identifiers_peak, long_loop.identifiers);
+}
+
+TEST_F(benchmark_test, nested_lookahead_keeps_tokens)
+{
+    // attribute references in the operands start a lookahead after the label and instruction were parsed
+    setUpAnalyzer(R"(
+&A       SETA  L'X
+&B       SETA  L'Y+&A
+         AIF   (&B NE 6).ERR
+X        DC    F'1'
+Y        DC    H'1'
+         AGO   .END
+.ERR     MNOTE 8,'WRONG'
+.END     ANOP
+)");
+    a->collect_diags();
+    EXPECT_EQ(a->diags().size(), (size_t)0);
+    EXPECT_GT(a->get_metrics().lookahead_statements, (size_t)0);
+}
@@ -15,12 +15,14 @@
 #include "gtest/gtest.h"
 
 #include "../common_testing.h"
+#include "expressions/ca_operator.h"
 #include "expressions/visitors/expression_evaluator.h"
 #include "parsing/parser_tools.h"
 
 // tests for
 // parsing various files
 // parsing CA expressions
+// resolving CA operator names
 
 class library_test : public testing::Test
 {
@@ -185,3 +187,22 @@ TEST_F(library_test, macro_model)
     // no errors found while parsing
     ASSERT_EQ(holder->parser().getNumberOfSyntaxErrors(), size_t_zero);
 }
+
+TEST(ca_operator, name_lookup)
+{
+    using namespace hlasm_plugin::parser_library::expressions;
+
+    EXPECT_EQ(ca_operator_from_name("EQ"), ca_operator::EQ);
+    EXPECT_EQ(ca_operator_from_name("index"), ca_operator::INDEX);
+    EXPECT_EQ(ca_operator_from_name("Sysattra"), ca_operator::SYSATTRA);
+    EXPECT_EQ(ca_operator_from_name("*"), ca_operator::ASTERISK);
+    EXPECT_EQ(ca_operator_from_name("EQU"), ca_operator::UNKNOWN);
+    EXPECT_EQ(ca_operator_from_name(""), ca_operator::UNKNOWN);
+
+    EXPECT_TRUE(is_ca_keyword(ca_operator::DOUBLE));
+    EXPECT_FALSE(is_ca_keyword(ca_operator::A2B));
+    EXPECT_FALSE(is_ca_keyword(ca_operator::UNKNOWN));
+
+    EXPECT_EQ(ca_operator_name(ca_operator::X2D), "X2D");
+    EXPECT_EQ(ca_operator_name(ca_operator::ASTERISK), "*");
+}
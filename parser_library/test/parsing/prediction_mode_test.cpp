@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "../common_testing.h"
+
+// tests that parsing operand fields with SLL prediction and falling back to LL
+// yields the same diagnostics as parsing with full LL prediction only
+
+using hlasm_plugin::parser_library::prediction_mode;
+
+namespace {
+
+struct analysis_result
+{
+    std::vector<std::string> diags;
+    performance_metrics metrics;
+};
+
+analysis_result analyze_with(const std::string& input, prediction_mode mode)
+{
+    analyzer_options options;
+    options.prediction = mode;
+
+    analyzer a(input, "", workspaces::empty_parse_lib_provider::instance, nullptr, false, options);
+    a.analyze();
+    a.collect_diags();
+
+    analysis_result result;
+    for (const auto& d : a.diags())
+        result.diags.push_back(d.code + " " + d.message + " " + std::to_string(d.diag_range.start.line) + ":"
+            + std::to_string(d.diag_range.start.column) + "-" + std::to_string(d.diag_range.end.line) + ":"
+            + std::to_string(d.diag_range.end.column));
+    result.metrics = a.get_metrics();
+    return result;
+}
+
+const std::vector<std::string> corpus_files = {
+    "model_statement",
+    "operand",
+    "comment",
+    "macro_model",
+    "op_alt_format_not_allowed",
+    "op_alt_format_allowed",
+    "simple",
+    "process",
+    "cont_no_op",
+    "continuation",
+    "cont_empty_op",
+    "long_macro",
+};
+
+const std::vector<std::string> corpus_sources = {
+    R"(
+         MACRO
+         M     &A,&B=(1,2),&C=
+         LR    &A,&B(1)
+         AIF   ('&C' EQ '').END
+         MNOTE 4,'&C'
+.END     ANOP
+         MEND
+         M     1,B=(3,4),C=X
+         M     (1,2),C=
+)",
+    R"(
+&A       SETA  1+2*(3-4)/5
+&B       SETB  (&A EQ 1 AND NOT 0)
+&C       SETC  'ABC'(1,2).'&A'
+         AIF   (&B).SKIP
+         AGO   .SKIP
+.SKIP    ANOP
+         LR    1,
+         LR    1,2,3
+ LA 1,0(,
+ DC C'A',F'1',3XL2'0',A(X+1)
+ DC F'1
+ USING *,12
+ DROP ,
+X        EQU   *+(2
+)",
+    R"(
+ LR 1,1 REMARK
+&VAR SETC 'LR'
+ &VAR 1,&SYSNDX(
+ ACTR LL'BTM 'M('SM''S(~''#S)((
+ (_=&LOCTRCEv(&ISEQ(--S'#)HUBP #' #&3#
+ @(PUSH@(&@(@+( ED'))D))))))))))9@(&@(@+( ED'BRXH))p(r
+)",
+};
+
+std::string read_corpus_file(const std::string& name)
+{
+    std::ifstream ifs("test/library/input/" + name + ".in");
+    return std::string((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+}
+
+} // namespace
+
+class prediction_mode_test : public testing::Test
+{
+protected:
+    void check_identical(const std::string& input)
+    {
+        auto ll = analyze_with(input, prediction_mode::LL);
+        auto sll = analyze_with(input, prediction_mode::SLL_THEN_LL);
+
+        EXPECT_EQ(ll.diags, sll.diags);
+        EXPECT_EQ(ll.metrics.sll_statements, (size_t)0);
+        EXPECT_EQ(ll.metrics.ll_fallback_statements, (size_t)0);
+
+        sll_statements += sll.metrics.sll_statements;
+        ll_fallback_statements += sll.metrics.ll_fallback_statements;
+    }
+
+    size_t sll_statements = 0;
+    size_t ll_fallback_statements = 0;
+};
+
+TEST_F(prediction_mode_test, corpus_files)
+{
+    for (const auto& name : corpus_files)
+    {
+        SCOPED_TRACE(name);
+        auto input = read_corpus_file(name);
+        ASSERT_FALSE(input.empty()) << "Tests must be started from the bin/ folder.";
+        check_identical(input);
+    }
+    EXPECT_GT(sll_statements, (size_t)0);
+}
+
+TEST_F(prediction_mode_test, corpus_sources)
+{
+    for (size_t i = 0; i < corpus_sources.size(); ++i)
+    {
+        SCOPED_TRACE(i);
+        check_identical(corpus_sources[i]);
+    }
+    EXPECT_GT(sll_statements, (size_t)0);
+    // syntax errors are reported only after falling back to LL
+    EXPECT_GT(ll_fallback_statements, (size_t)0);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include "gtest/gtest.h"
+
+#include "../common_testing.h"
+
+// tests that checking of postponed statements in parallel
+// yields the same diagnostics in the same order as the sequential checking
+
+namespace {
+
+std::string make_forward_references(size_t count)
+{
+    std::string input = R"(
+         MACRO
+&L       GEN   &R
+&L       LA    &R,FAR
+         DC    A(NEAR)
+         LA    1,BIG
+         MEND
+)";
+    for (size_t i = 0; i < count; ++i)
+    {
+        input.append("         GEN   ").append(std::to_string(i % 16)).append("\n");
+        input.append("         LA    2,BIG+").append(std::to_string(i)).append("\n");
+    }
+    input.append(R"(
+FAR      EQU   10
+NEAR     EQU   *
+BIG      EQU   5000
+)");
+    return input;
+}
+
+std::vector<std::string> analyze_with(const std::string& input, size_t threads)
+{
+    analyzer a(input, "", workspaces::empty_parse_lib_provider::instance, nullptr, false, analyzer_options { threads });
+    a.analyze();
+    a.collect_diags();
+
+    std::vector<std::string> result;
+    for (const auto& d : a.diags())
+        result.push_back(d.code + " " + d.message + " " + std::to_string(d.diag_range.start.line) + ":"
+            + std::to_string(d.diag_range.start.column));
+    return result;
+}
+
+} // namespace
+
+TEST(postponed_check, parallel_same_diagnostics)
+{
+    auto input = make_forward_references(2000);
+
+    auto sequential = analyze_with(input, 1);
+    auto parallel = analyze_with(input, 4);
+
+    EXPECT_FALSE(sequential.empty());
+    EXPECT_EQ(sequential, parallel);
+}
+
+TEST(postponed_check, few_statements)
+{
+    auto input = make_forward_references(10);
+
+    EXPECT_EQ(analyze_with(input, 1), analyze_with(input, 8));
+}
+
+TEST(postponed_check, unresolved_spaces)
+{
+    // the length of the area is never known, so the addresses after it keep an unresolved space
+    std::string input = "         DS    (UNKNOWN)C\n";
+    for (size_t i = 0; i < 4000; ++i)
+        input.append("         LA    1,FIELD\n");
+    input.append("FIELD    DS    F\n");
+
+    auto sequential = analyze_with(input, 1);
+    auto parallel = analyze_with(input, 4);
+
+    EXPECT_FALSE(sequential.empty());
+    EXPECT_EQ(sequential, parallel);
+}
@@ -12,6 +12,8 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 #include "../mock_parse_lib_provider.h"
@@ -178,14 +180,120 @@ TEST_F(lsp_features_test, hover)
     ASSERT_EQ((size_t)0, result.size());
 }
 
+// hover texts are generated from the context when requested
+TEST(lsp_hover, generated_on_request)
+{
+    std::string input = R"( LR 1,1
+       MACRO
+       M2
+*DOC
+       MEND
+ M2
+A DC F'1'
+B EQU A+4
+ LR 1,1
+)";
+    analyzer a(input);
+    a.analyze();
+
+    // instruction used before the macro was added to the completion items
+    auto result = a.lsp_processor().hover(position(0, 2));
+    ASSERT_FALSE(result.empty());
+    EXPECT_EQ(0U, result[0].find("Operands: "));
+    EXPECT_EQ(result, a.lsp_processor().hover(position(8, 2)));
+
+    result = a.lsp_processor().hover(position(5, 2));
+    ASSERT_EQ((size_t)3, result.size());
+    EXPECT_EQ("version 0", result[1]);
+    EXPECT_EQ("DOC", result[2]);
+
+    result = a.lsp_processor().hover(position(6, 0));
+    ASSERT_LE((size_t)2, result.size());
+    EXPECT_EQ("Relocatable Symbol", result[1]);
+    EXPECT_NE(result.end(), std::find(result.begin(), result.end(), "L: 4"));
+    EXPECT_NE(result.end(), std::find(result.begin(), result.end(), "T: F"));
+
+    result = a.lsp_processor().hover(position(7, 0));
+    ASSERT_LE((size_t)2, result.size());
+    EXPECT_EQ("Relocatable Symbol", result[1]);
+}
+
 // completion for variable symbols (&), sequence syms (.) and instructions ((S*)(s+)(S*))
 TEST_F(lsp_features_test, completion)
 {
-    // all instructions + 2 newly defined macros
-    EXPECT_EQ(instruction_count + 2, a.lsp_processor().completion(position(26, 1), '\0', 1).items.size());
+    // all instructions + 2 newly defined macros, only the first page is returned
+    auto instructions = a.lsp_processor().completion(position(26, 1), '\0', 1);
+    EXPECT_TRUE(instructions.is_incomplete);
+    EXPECT_EQ(semantics::completion_page_size, instructions.items.size());
+    EXPECT_EQ(instruction_count + 2, a.context().lsp_ctx->instruction_index.size());
     // current scope detection missing !
     // seq symbols
     EXPECT_EQ((size_t)1, a.lsp_processor().completion(position(6, 0), '.', 2).items.size());
     // var symbols
     EXPECT_EQ((size_t)3, a.lsp_processor().completion(position(10, 0), '&', 2).items.size());
 }
+
+// completion returns only items starting with the typed prefix, documentation is resolved later
+TEST(lsp_completion, prefix)
+{
+    std::string input = R"(
+&VAR1  SETA 1
+&VAR2  SETA 2
+&OTHER SETA 3
+.SEQ   ANOP
+       MACRO
+       MACX
+*MACRO DOCUMENTATION
+       MEND
+       mac
+LBL    MVC
+       AIF  (&VA
+       AGO  .S
+)";
+    analyzer a(input);
+    a.analyze();
+
+    auto macros = a.lsp_processor().completion(position(9, 10), '\0', 1);
+    EXPECT_FALSE(macros.is_incomplete);
+    ASSERT_EQ((size_t)2, macros.items.size());
+    EXPECT_EQ("MACRO", macros.items[0].label);
+    EXPECT_EQ("MACX", macros.items[1].label);
+    EXPECT_TRUE(macros.items[1].get_contents().empty());
+    EXPECT_TRUE(macros.items[1].instruction);
+
+    auto labeled = a.lsp_processor().completion(position(10, 10), '\0', 1);
+    ASSERT_FALSE(labeled.items.empty());
+    for (const auto& item : labeled.items)
+        EXPECT_EQ(0U, item.label.find("MVC"));
+
+    auto vars = a.lsp_processor().completion(position(11, 16), '\0', 1);
+    ASSERT_EQ((size_t)2, vars.items.size());
+    EXPECT_EQ("VAR1", vars.items[0].label);
+    EXPECT_EQ("VAR2", vars.items[1].label);
+    EXPECT_FALSE(vars.items[0].instruction);
+
+    auto seqs = a.lsp_processor().completion(position(12, 14), '\0', 1);
+    ASSERT_EQ((size_t)1, seqs.items.size());
+    EXPECT_EQ("SEQ", seqs.items[0].label);
+}
+
+TEST(lsp_completion, resolve)
+{
+    std::string input = R"(
+       MACRO
+       MACX
+*MACRO DOCUMENTATION
+       MEND
+)";
+    analyzer a(input);
+    a.analyze();
+
+    auto macro = a.lsp_processor().resolve_completion("MACX");
+    EXPECT_EQ("MACRO DOCUMENTATION\n", macro.content_string);
+
+    auto machine = a.lsp_processor().resolve_completion("LR");
+    EXPECT_NE(std::string::npos, machine.content_string.find("Machine instruction"));
+
+    auto unknown = a.lsp_processor().resolve_completion("UNKNOWN");
+    EXPECT_EQ("", unknown.content_string);
+}
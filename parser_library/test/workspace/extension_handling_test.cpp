@@ -40,39 +40,43 @@ TEST(extension_handling_test, wildcard)
 {
     std::string test = "this is a test sentence.";
 
-    auto regex = wildcard2regex("*test*");
-    EXPECT_TRUE(std::regex_match(test, regex));
+    EXPECT_TRUE(wildcard("*test*").match(test));
+    EXPECT_TRUE(wildcard("*.").match(test));
+    EXPECT_TRUE(wildcard("this is a test ?entence.").match(test));
+    EXPECT_FALSE(wildcard("*.?").match(test));
 
-    regex = wildcard2regex("*.");
-    EXPECT_TRUE(std::regex_match(test, regex));
+    EXPECT_TRUE(wildcard("this+.").match(test));
+    EXPECT_FALSE(wildcard("this is a test sentence.+").match(test));
+    EXPECT_TRUE(wildcard("t*s*s*.").match(test));
+    EXPECT_FALSE(wildcard("t*x*.").match(test));
+    EXPECT_TRUE(wildcard("**").match(""));
 
-    regex = wildcard2regex("this is a test ?entence.");
-    EXPECT_TRUE(std::regex_match(test, regex));
-
-    regex = wildcard2regex("*.?");
-    EXPECT_FALSE(std::regex_match(test, regex));
+    EXPECT_TRUE(is_wildcard("pgms/*.asm"));
+    EXPECT_TRUE(is_wildcard("pgms/+.asm"));
+    EXPECT_TRUE(is_wildcard("pgms/pgm?.asm"));
+    EXPECT_FALSE(is_wildcard("pgms/pgm1.asm"));
 }
 
 TEST(extension_handling_test, extension_removal)
 {
     file_manager_extension_mock file_mngr;
     // file must end with hlasm, true for lib/Mac.hlasm
-    extension_regex_map map { { ".hlasm", wildcard2regex("*.hlasm") } };
-    library_local lib(file_mngr, "lib", std::make_shared<const extension_regex_map>(map));
+    extension_wildcard_map map { { ".hlasm", wildcard("*.hlasm") } };
+    library_local lib(file_mngr, "lib", std::make_shared<const extension_wildcard_map>(map));
     EXPECT_NE(lib.find_file("MAC"), nullptr);
 
     // file must end with hlasm and be in folder lib, true for lib/Mac.hlasm
-    map = { { ".hlasm", wildcard2regex("*" + lib_path + "*.hlasm") } };
-    library_local lib2(file_mngr, "lib", std::make_shared<const extension_regex_map>(map));
+    map = { { ".hlasm", wildcard("*" + lib_path + "*.hlasm") } };
+    library_local lib2(file_mngr, "lib", std::make_shared<const extension_wildcard_map>(map));
     EXPECT_NE(lib2.find_file("MAC"), nullptr);
 
     // file must end with asm, false for lib/Mac.hlasm
-    map = { { ".asm", wildcard2regex("*.asm") } };
-    library_local lib3(file_mngr, "lib", std::make_shared<const extension_regex_map>(map));
+    map = { { ".asm", wildcard("*.asm") } };
+    library_local lib3(file_mngr, "lib", std::make_shared<const extension_wildcard_map>(map));
     EXPECT_EQ(lib3.find_file("MAC"), nullptr);
 
     // file must end with hlasm and be in folder lib2, false for lib/Mac.hlasm
-    extension_regex_map map2 { { ".hlasm", wildcard2regex("*" + lib_path2 + "*.hlasm") } };
-    library_local lib4(file_mngr, "lib2", std::make_shared<const extension_regex_map>(map2));
+    extension_wildcard_map map2 { { ".hlasm", wildcard("*" + lib_path2 + "*.hlasm") } };
+    library_local lib4(file_mngr, "lib2", std::make_shared<const extension_wildcard_map>(map2));
     EXPECT_EQ(lib4.find_file("MAC"), nullptr);
 }
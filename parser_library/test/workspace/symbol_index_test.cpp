@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+#include "../mock_parse_lib_provider.h"
+#include "analyzer.h"
+#include "workspaces/symbol_index.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+
+namespace {
+// both programs use the copy member, the first one uses the macro as well
+const std::string program_a = R"( MAC 1
+ COPY COPYFILE
+ LR R2,R2
+)";
+const std::string program_b = R"( COPY COPYFILE
+ L 1,R2
+LOCAL EQU 1
+)";
+
+const index_symbol* find_one(const symbol_index& index, const std::string& name)
+{
+    auto found = index.find(name, workspace_symbol_limit);
+    if (found.size() != 1 || found[0]->name != name)
+        return nullptr;
+    return found[0];
+}
+} // namespace
+
+TEST(symbol_index, symbols_shared_by_programs)
+{
+    mock_parse_lib_provider lib_provider;
+    analyzer a(program_a, "A", lib_provider);
+    a.analyze();
+    analyzer b(program_b, "B", lib_provider);
+    b.analyze();
+
+    symbol_index index;
+    index.update("A", a.context());
+    index.update("B", b.context());
+    EXPECT_EQ(index.program_count(), (size_t)2);
+
+    auto mac = find_one(index, "MAC");
+    ASSERT_NE(mac, nullptr);
+    EXPECT_EQ(mac->kind, workspace_symbol_kind::macro);
+    EXPECT_EQ(mac->file, MACRO_FILE);
+    EXPECT_EQ(index.programs(*mac), std::vector<std::string> { "A" });
+
+    auto copy = find_one(index, "COPYFILE");
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(copy->kind, workspace_symbol_kind::copy_member);
+    EXPECT_EQ(index.programs(*copy), (std::vector<std::string> { "A", "B" }));
+
+    // ordinary symbol defined in the copy member is the same symbol in both programs
+    auto r2 = index.defined_at(COPY_FILE, position(0, 0));
+    ASSERT_NE(r2, nullptr);
+    EXPECT_EQ(r2->name, "R2");
+    EXPECT_EQ(r2->kind, workspace_symbol_kind::ordinary);
+    auto occurrences = index.occurrences(*r2);
+    auto in_file = [&occurrences](const std::string& file) {
+        return std::count_if(
+            occurrences.begin(), occurrences.end(), [&file](const auto& occ) { return *occ.file == file; });
+    };
+    EXPECT_EQ(in_file("A"), 2);
+    EXPECT_EQ(in_file("B"), 1);
+    // occurrences in the copy member are reported once although both programs use it
+    for (auto it = occurrences.begin(); it != occurrences.end(); ++it)
+        EXPECT_EQ(std::count(occurrences.begin(), occurrences.end(), *it), 1);
+
+    auto local = find_one(index, "LOCAL");
+    ASSERT_NE(local, nullptr);
+    EXPECT_EQ(index.programs(*local), std::vector<std::string> { "B" });
+}
+
+TEST(symbol_index, prefix_search)
+{
+    mock_parse_lib_provider lib_provider;
+    analyzer b(program_b, "B", lib_provider);
+    b.analyze();
+
+    symbol_index index;
+    index.update("B", b.context());
+
+    auto all = index.find("", workspace_symbol_limit);
+    EXPECT_EQ(all.size(), index.symbol_count());
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end(), [](auto l, auto r) { return l->name < r->name; }));
+
+    EXPECT_EQ(index.find("LOC", workspace_symbol_limit).size(), (size_t)1);
+    EXPECT_EQ(index.find("", 1).size(), (size_t)1);
+    EXPECT_TRUE(index.find("X", workspace_symbol_limit).empty());
+}
+
+TEST(symbol_index, update_replaces_program)
+{
+    mock_parse_lib_provider lib_provider;
+    analyzer a(program_a, "A", lib_provider);
+    a.analyze();
+    analyzer b(program_b, "B", lib_provider);
+    b.analyze();
+
+    symbol_index index;
+    index.update("A", a.context());
+    index.update("B", b.context());
+
+    // the program no longer defines LOCAL
+    analyzer b_changed(" COPY COPYFILE\n", "B", lib_provider);
+    b_changed.analyze();
+    index.update("B", b_changed.context());
+    EXPECT_EQ(index.program_count(), (size_t)2);
+    EXPECT_TRUE(index.find("LOCAL", workspace_symbol_limit).empty());
+    auto copy = find_one(index, "COPYFILE");
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(index.programs(*copy), (std::vector<std::string> { "A", "B" }));
+
+    index.remove("B");
+    EXPECT_EQ(index.program_count(), (size_t)1);
+    EXPECT_EQ(index.programs(*copy), std::vector<std::string> { "A" });
+
+    index.remove("A");
+    EXPECT_EQ(index.symbol_count(), (size_t)0);
+    EXPECT_EQ(index.defined_at(COPY_FILE, position(0, 0)), nullptr);
+}
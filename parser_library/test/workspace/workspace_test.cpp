@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iterator>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -366,9 +367,9 @@ std::string source_using_macro_file_no_error = R"( CORRECT)";
 class file_with_text : public processor_file_impl
 {
 public:
-    file_with_text(const std::string& name, const std::string& text)
+    file_with_text(const std::string& name, const std::string& text, std::atomic<bool>* cancel = nullptr)
         : file_impl(name)
-        , processor_file_impl(name)
+        , processor_file_impl(name, cancel)
     {
         did_open(text, 1);
     }
@@ -391,15 +392,17 @@ std::string hlasmplugin_folder = ".hlasmplugin/";
 class file_manager_extended : public file_manager_impl
 {
 public:
-    file_manager_extended()
+    // the open code files are analyzed with the cancellation token
+    file_manager_extended(std::atomic<bool>* cancel = nullptr)
     {
         files_.emplace(
             hlasmplugin_folder + "proc_grps.json", std::make_unique<file_with_text>("proc_grps.json", pgroups_file));
         files_.emplace(
             hlasmplugin_folder + "pgm_conf.json", std::make_unique<file_with_text>("pgm_conf.json", pgmconf_file));
-        files_.emplace("source1", std::make_unique<file_with_text>("source1", source_using_macro_file));
-        files_.emplace("source2", std::make_unique<file_with_text>("source2", source_using_macro_file));
-        files_.emplace("source3", std::make_unique<file_with_text>("source3", source_using_macro_file_no_error));
+        files_.emplace("source1", std::make_unique<file_with_text>("source1", source_using_macro_file, cancel));
+        files_.emplace("source2", std::make_unique<file_with_text>("source2", source_using_macro_file, cancel));
+        files_.emplace(
+            "source3", std::make_unique<file_with_text>("source3", source_using_macro_file_no_error, cancel));
         files_.emplace(faulty_macro_path, std::make_unique<file_with_text>(faulty_macro_path, faulty_macro_file));
         files_.emplace(correct_macro_path, std::make_unique<file_with_text>(correct_macro_path, correct_macro_file));
     }
@@ -411,6 +414,11 @@ public:
         return { { "ERROR", "ERROR" } };
     }
 
+    virtual bool file_exists(const std::string& file_name) override
+    {
+        return insert_correct_macro || file_name != correct_macro_path;
+    }
+
     bool insert_correct_macro = true;
 };
 
@@ -481,3 +489,432 @@ TEST_F(workspace_test, did_change_watched_files)
     ws.did_change_file("source3", changes.data(), changes.size());
     ASSERT_EQ(collect_and_get_diags_size(ws, file_manager), (size_t)0);
 }
+
+TEST_F(workspace_test, background_analysis)
+{
+    file_manager_extended file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.set_background_analysis(true);
+    ws.open();
+
+    // both sources use macro ERROR, source2 is the active file
+    ws.did_open_file("source1");
+    ws.did_open_file("source2");
+    ASSERT_EQ(collect_and_get_diags_size(ws, file_manager), (size_t)3);
+    EXPECT_FALSE(ws.background_analysis_step());
+
+    auto generation = [&file_manager](const std::string& name) {
+        return std::dynamic_pointer_cast<processor_file_impl>(file_manager.find_processor_file(name))
+            ->diagnostics_generation();
+    };
+    auto source1 = generation("source1");
+    auto source2 = generation("source2");
+
+    // only the active dependant of the changed macro is analyzed right away
+    ws.did_change_watched_files(faulty_macro_path);
+    EXPECT_EQ(generation("source1"), source1);
+    EXPECT_NE(generation("source2"), source2);
+
+    EXPECT_TRUE(ws.background_analysis_step());
+    EXPECT_NE(generation("source1"), source1);
+    EXPECT_FALSE(ws.background_analysis_step());
+    ASSERT_EQ(collect_and_get_diags_size(ws, file_manager), (size_t)3);
+
+    // a waiting file that gets closed is not analyzed
+    ws.did_change_watched_files(faulty_macro_path);
+    ws.did_close_file("source1");
+    EXPECT_FALSE(ws.background_analysis_step());
+}
+
+TEST_F(workspace_test, preempted_analysis_requeued)
+{
+    std::atomic<bool> cancel = false;
+    file_manager_extended file_manager(&cancel);
+    workspace ws("", "workspace_name", file_manager);
+    ws.set_background_analysis(true);
+    ws.open();
+
+    ws.did_open_file("source1");
+    EXPECT_FALSE(ws.background_analysis_step());
+    auto source1 = std::dynamic_pointer_cast<processor_file_impl>(file_manager.find_processor_file("source1"));
+    auto generation = source1->diagnostics_generation();
+
+    // a request about another file preempts the analysis of the active file
+    cancel = true;
+    std::vector<document_change> changes;
+    std::string new_text = "";
+    changes.push_back(document_change({ { 0, 0 }, { 0, 0 } }, new_text.c_str(), new_text.size()));
+    ws.did_change_file("source1", changes.data(), changes.size());
+    EXPECT_EQ(source1->diagnostics_generation(), generation);
+
+    // the background analysis finishes it
+    cancel = false;
+    EXPECT_TRUE(ws.background_analysis_step());
+    EXPECT_NE(source1->diagnostics_generation(), generation);
+    EXPECT_FALSE(ws.background_analysis_step());
+}
+
+TEST_F(workspace_test, analyzer_options)
+{
+    file_manager_extended file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.open();
+    ws.set_analyzer_options(analyzer_options { 4 });
+
+    ws.did_open_file("source3");
+    auto ctx = file_manager.find_processor_file("source3")->analysis_context();
+    ASSERT_NE(ctx, nullptr);
+    EXPECT_EQ(ctx->options().checking_threads, (size_t)4);
+}
+
+TEST_F(workspace_test, preempted_analysis_keeps_diagnostics)
+{
+    std::atomic<bool> cancel = false;
+    file_with_text source("source1", source_using_macro_file, &cancel);
+    EXPECT_TRUE(source.parse(empty_parse_lib_provider::instance));
+    auto diags_count = source.diags().size();
+    auto generation = source.diagnostics_generation();
+    ASSERT_GT(diags_count, (size_t)0);
+
+    // the preempted analysis does not replace the diagnostics by its partial ones
+    cancel = true;
+    EXPECT_FALSE(source.parse(empty_parse_lib_provider::instance));
+    EXPECT_EQ(source.diags().size(), diags_count);
+    EXPECT_EQ(source.diagnostics_generation(), generation);
+
+    // the repeated analysis does
+    cancel = false;
+    EXPECT_TRUE(source.parse(empty_parse_lib_provider::instance));
+    EXPECT_EQ(source.diags().size(), diags_count);
+    EXPECT_NE(source.diagnostics_generation(), generation);
+}
+
+TEST_F(workspace_test, memory_budget_eviction)
+{
+    file_manager_extended file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.open();
+
+    // source1 uses macro ERROR, source3 uses macro CORRECT
+    ws.did_open_file("source1");
+    ws.did_open_file("source3");
+    auto source1 = file_manager.find_processor_file("source1");
+    auto source3 = file_manager.find_processor_file("source3");
+    auto macro = file_manager.find_processor_file(faulty_macro_path);
+    ASSERT_TRUE(source1->resident());
+    ASSERT_TRUE(source3->resident());
+    ASSERT_TRUE(macro->resident());
+    auto diags_count = collect_and_get_diags_size(ws, file_manager);
+    auto resident_memory = file_manager.resident_memory();
+    EXPECT_GT(resident_memory, (size_t)0);
+
+    // files open in the editor are never evicted
+    file_manager.set_memory_budget(1);
+    file_manager.enforce_memory_budget();
+    EXPECT_TRUE(source1->resident());
+    EXPECT_TRUE(source3->resident());
+
+    // source1 is kept while its dependency is open, because the macro was parsed in its context
+    source1->did_close();
+    file_manager.enforce_memory_budget();
+    EXPECT_TRUE(source1->resident());
+
+    macro->did_close();
+    file_manager.enforce_memory_budget();
+    EXPECT_FALSE(source1->resident());
+    EXPECT_FALSE(macro->resident());
+    EXPECT_TRUE(source3->resident());
+    EXPECT_LT(file_manager.resident_memory(), resident_memory);
+
+    // diagnostics, dependencies and metrics outlive the evicted state
+    EXPECT_EQ(collect_and_get_diags_size(ws, file_manager), diags_count);
+    EXPECT_EQ(source1->dependencies().size(), (size_t)1);
+    EXPECT_GT(source1->get_metrics().open_code_statements, (size_t)0);
+
+    // the state is rebuilt when the file is parsed again
+    ws.parse_file("source1");
+    EXPECT_TRUE(source1->resident());
+    EXPECT_TRUE(macro->resident());
+    EXPECT_EQ(collect_and_get_diags_size(ws, file_manager), diags_count);
+}
+
+TEST_F(workspace_test, restore_evicted_dependency)
+{
+    file_manager_extended file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.open();
+
+    // source1 and source2 both use macro ERROR
+    ws.did_open_file("source1");
+    ws.did_open_file("source2");
+    auto source1 = file_manager.find_processor_file("source1");
+    auto source2 = file_manager.find_processor_file("source2");
+    auto macro = file_manager.find_processor_file(faulty_macro_path);
+    auto diags_count = collect_and_get_diags_size(ws, file_manager);
+
+    source1->did_close();
+    source2->did_close();
+    macro->did_close();
+    file_manager.set_memory_budget(1);
+    file_manager.enforce_memory_budget();
+    ASSERT_FALSE(source1->resident());
+    ASSERT_FALSE(source2->resident());
+    ASSERT_FALSE(macro->resident());
+
+    // the dependency is restored by analyzing one of its dependants only
+    ws.restore_file(faulty_macro_path);
+    EXPECT_TRUE(macro->resident());
+    EXPECT_NE(source1->resident(), source2->resident());
+    EXPECT_EQ(collect_and_get_diags_size(ws, file_manager), diags_count);
+
+    // an open code is restored on its own
+    ws.restore_file("source2");
+    EXPECT_TRUE(source2->resident());
+}
+
+TEST(file_manager, list_updated_files)
+{
+    file_manager_impl file_manager;
+    file_manager.did_open_file("source1", 1, " LR 1,1");
+    file_manager.did_open_file("source2", 1, " LR 1,1");
+    auto source1 = file_manager.add_processor_file("source1");
+    auto source2 = file_manager.add_processor_file("source2");
+
+    // only parsed files are listed and each parse is reported once
+    source1->parse(empty_parse_lib_provider::instance);
+    auto updated = file_manager.list_updated_files();
+    ASSERT_EQ(updated.size(), (size_t)1);
+    EXPECT_EQ(updated[0], source1);
+    EXPECT_TRUE(file_manager.list_updated_files().empty());
+
+    // files may be parsed by other threads
+    std::thread([&source2]() { source2->parse(empty_parse_lib_provider::instance); }).join();
+    updated = file_manager.list_updated_files();
+    ASSERT_EQ(updated.size(), (size_t)1);
+    EXPECT_EQ(updated[0], source2);
+
+    // removed files are not listed
+    source1->parse(empty_parse_lib_provider::instance);
+    file_manager.remove_file("source1");
+    EXPECT_TRUE(file_manager.list_updated_files().empty());
+}
+
+constexpr size_t many_members_count = 50000;
+
+class file_manager_many_members : public file_manager_impl
+{
+public:
+    file_manager_many_members()
+    {
+        files_.emplace(
+            hlasmplugin_folder + "proc_grps.json", std::make_unique<file_with_text>("proc_grps.json", pgroups_file));
+        files_.emplace(
+            hlasmplugin_folder + "pgm_conf.json", std::make_unique<file_with_text>("pgm_conf.json", pgmconf_file));
+        for (size_t i = 0; i < many_members_count; ++i)
+            members.emplace("MAC" + std::to_string(i), "MAC" + std::to_string(i));
+    }
+
+    virtual std::unordered_map<std::string, std::string> list_directory_files(const std::string&) override
+    {
+        ++list_calls;
+        return members;
+    }
+
+    virtual bool file_exists(const std::string& file_name) override
+    {
+        return members.find(std::filesystem::path(file_name).filename().string()) != members.end();
+    }
+
+    virtual bool prefetch_file(const std::string& file_name, const std::atomic<bool>* cancel) override
+    {
+        prefetched.push_back(file_name);
+        return file_manager_impl::prefetch_file(file_name, cancel);
+    }
+
+    std::unordered_map<std::string, std::string> members;
+    size_t list_calls = 0;
+    std::vector<std::string> prefetched;
+};
+
+TEST_F(workspace_test, library_member_index)
+{
+    file_manager_many_members file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.open();
+    context::hlasm_context ctx("source1");
+
+    for (size_t i = 0; i < many_members_count; ++i)
+        ASSERT_TRUE(ws.has_library("MAC" + std::to_string(i), ctx));
+    // repeated misses are answered from the index
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 1000; ++j)
+            ASSERT_FALSE(ws.has_library("OPCODE" + std::to_string(j), ctx));
+    EXPECT_EQ(file_manager.list_calls, (size_t)1);
+
+    // change of a file outside of the library does not reload it
+    ws.did_change_watched_files("source1");
+    EXPECT_EQ(file_manager.list_calls, (size_t)1);
+
+    // removed member is no longer found
+    file_manager.members.erase("MAC0");
+    ws.did_change_watched_files((std::filesystem::path("lib") / "MAC0").string());
+    EXPECT_FALSE(ws.has_library("MAC0", ctx));
+    EXPECT_TRUE(ws.has_library("MAC1", ctx));
+
+    // added member is found even though it was cached as missing
+    file_manager.members.emplace("OPCODE0", "OPCODE0");
+    ws.did_change_watched_files((std::filesystem::path("lib") / "OPCODE0").string());
+    EXPECT_TRUE(ws.has_library("OPCODE0", ctx));
+    EXPECT_FALSE(ws.has_library("OPCODE1", ctx));
+
+    // the library directory is listed only once, changes are applied per file
+    EXPECT_EQ(file_manager.list_calls, (size_t)1);
+
+    // members of a created, deleted or renamed library directory are not known, the libraries are listed again
+    file_manager.members.erase("MAC1");
+    ws.did_change_watched_files("lib");
+    EXPECT_EQ(file_manager.list_calls, (size_t)2);
+    EXPECT_FALSE(ws.has_library("MAC1", ctx));
+    EXPECT_TRUE(ws.has_library("MAC2", ctx));
+    EXPECT_EQ(file_manager.list_calls, (size_t)2);
+}
+
+TEST_F(workspace_test, warm_up)
+{
+    file_manager_many_members file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.open();
+    EXPECT_EQ(file_manager.list_calls, (size_t)0);
+
+    size_t steps = 0;
+    while (ws.warm_up_step())
+        ++steps;
+    EXPECT_GT(steps, (size_t)0);
+    EXPECT_EQ(file_manager.list_calls, (size_t)1);
+    EXPECT_FALSE(ws.warm_up_step());
+
+    // the first lookup is answered from the listing of the warm-up
+    context::hlasm_context ctx("source1");
+    EXPECT_TRUE(ws.has_library("MAC0", ctx));
+    EXPECT_EQ(file_manager.list_calls, (size_t)1);
+}
+
+TEST_F(workspace_test, warm_up_cancel)
+{
+    file_manager_many_members file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.open();
+
+    // a cancelled step is repeated by the next one
+    std::atomic<bool> cancel = true;
+    EXPECT_TRUE(ws.warm_up_step(&cancel));
+    EXPECT_EQ(file_manager.list_calls, (size_t)0);
+
+    cancel = false;
+    while (ws.warm_up_step(&cancel))
+        ;
+    EXPECT_EQ(file_manager.list_calls, (size_t)1);
+}
+
+TEST_F(workspace_test, member_usage_persistence)
+{
+    auto usage_dir = std::filesystem::temp_directory_path() / "hlasm_member_usage_test";
+    auto usage_file = usage_dir / "member_usage.json";
+    std::filesystem::remove_all(usage_dir);
+
+    {
+        file_manager_many_members file_manager;
+        workspace ws("", "workspace_name", file_manager);
+        ws.set_member_usage_file(usage_file);
+        ws.open();
+        context::hlasm_context ctx("source1");
+        ws.parse_library("MAC1", ctx, library_data { processing::processing_kind::MACRO, ctx.ids().add("MAC1") });
+        // a single use is not worth rewriting the file during the session
+        while (ws.warm_up_step())
+            ;
+        EXPECT_FALSE(std::filesystem::exists(usage_file));
+        ws.close();
+    }
+    ASSERT_TRUE(std::filesystem::exists(usage_file));
+
+    // the member used in the previous session is read ahead
+    file_manager_many_members file_manager;
+    workspace ws("", "workspace_name", file_manager);
+    ws.set_member_usage_file(usage_file);
+    ws.open();
+    while (ws.warm_up_step())
+        ;
+    ASSERT_EQ(file_manager.prefetched.size(), (size_t)1);
+    EXPECT_EQ(std::filesystem::path(file_manager.prefetched[0]).filename(), "MAC1");
+
+    // the member is not on the disk, so there is nothing to load
+    EXPECT_EQ(file_manager.find(file_manager.prefetched[0]), nullptr);
+
+    std::filesystem::remove_all(usage_dir);
+}
+
+TEST_F(workspace_test, prefetch_library_member)
+{
+    auto root = std::filesystem::temp_directory_path() / "hlasm_prefetch_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    auto member = (root / "MAC1").string();
+    std::ofstream(member, std::ios::binary) << correct_macro_file;
+
+    file_manager_impl file_manager;
+
+    // the member does not fit into the memory budget
+    file_manager.set_memory_budget(1);
+    EXPECT_TRUE(file_manager.prefetch_file(member, nullptr));
+    EXPECT_EQ(file_manager.find(member), nullptr);
+
+    // the loaded member is kept for the first program that uses it
+    file_manager.set_memory_budget(0);
+    EXPECT_TRUE(file_manager.prefetch_file(member, nullptr));
+    auto file = file_manager.find(member);
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(file->get_text(), correct_macro_file);
+
+    std::atomic<bool> cancel = true;
+    EXPECT_FALSE(file_manager.prefetch_file((root / "MAC2").string(), &cancel));
+
+    std::filesystem::remove_all(root);
+}
+
+TEST_F(workspace_test, index_programs_not_opened)
+{
+    auto root = std::filesystem::temp_directory_path() / "hlasm_index_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / ".hlasmplugin");
+    std::filesystem::create_directories(root / "lib");
+    auto write = [](const std::filesystem::path& path, const std::string& text) { std::ofstream(path) << text; };
+    write(root / ".hlasmplugin" / "proc_grps.json", pgroups_file);
+    write(root / ".hlasmplugin" / "pgm_conf.json", pgmconf_file);
+    write(root / "lib" / "CORRECT", correct_macro_file);
+    write(root / "source1", source_using_macro_file);
+    write(root / "source3", source_using_macro_file_no_error);
+    auto source3 = (root / "source3").string();
+
+    file_manager_impl file_manager;
+    workspace ws(root.string(), "workspace_name", file_manager);
+    ws.open();
+    while (ws.index_step())
+        ;
+
+    // the existing programs of the configuration are indexed, but they are not kept open
+    const auto& index = ws.get_symbol_index();
+    EXPECT_EQ(index.program_count(), (size_t)2);
+    EXPECT_EQ(file_manager.find(source3), nullptr);
+    auto correct = index.find("CORRECT", workspace_symbol_limit);
+    ASSERT_EQ(correct.size(), (size_t)1);
+    EXPECT_EQ(index.programs(*correct[0]), std::vector<std::string> { source3 });
+    EXPECT_EQ(file_manager.find(correct[0]->file), nullptr);
+
+    // deleted program is removed from the index
+    std::filesystem::remove(source3);
+    ws.did_change_watched_files(source3);
+    EXPECT_EQ(index.program_count(), (size_t)1);
+    EXPECT_TRUE(index.find("CORRECT", workspace_symbol_limit).empty());
+
+    std::filesystem::remove_all(root);
+}
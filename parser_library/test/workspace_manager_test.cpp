@@ -12,6 +12,10 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
 #include "gtest/gtest.h"
 
 #include "workspace_manager.h"
@@ -96,4 +100,102 @@ TEST(workspace_manager, did_change_file)
     ws_mngr.did_change_file("test/library/test_wks/new_file", 3, changes1.data(), 1);
 
     EXPECT_GT(consumer.diags.diagnostics_size(), (size_t)0);
-}
\ No newline at end of file
+}
+
+TEST(workspace_manager, did_change_file_keeps_other_file_diagnostics)
+{
+    workspace_manager ws_mngr;
+    diag_consumer_mock consumer;
+    ws_mngr.register_diagnostics_consumer(&consumer);
+
+    ws_mngr.add_workspace("workspace", "test/library/test_wks");
+    std::string input = "label lr 1,2 remark";
+    std::string faulty = "label anop";
+    ws_mngr.did_open_file("test/library/test_wks/new_file", 1, input.c_str(), input.size());
+    ws_mngr.did_open_file("test/library/test_wks/faulty_file", 1, faulty.c_str(), faulty.size());
+
+    ASSERT_EQ(consumer.diags.diagnostics_size(), (size_t)1);
+    EXPECT_STREQ(consumer.diags.diagnostics(0).file_name(), "test/library/test_wks/faulty_file");
+
+    std::vector<document_change> changes;
+    std::string new_text = "anop";
+    changes.push_back(document_change({ { 0, 6 }, { 0, input.size() } }, new_text.c_str(), new_text.size()));
+
+    ws_mngr.did_change_file("test/library/test_wks/new_file", 2, changes.data(), 1);
+
+    ASSERT_EQ(consumer.diags.diagnostics_size(), (size_t)2);
+    EXPECT_STRNE(consumer.diags.diagnostics(0).file_name(), consumer.diags.diagnostics(1).file_name());
+
+    std::vector<document_change> changes1;
+    std::string new_text1 = "lr 1,2";
+    changes1.push_back(document_change({ { 0, 6 }, { 0, 10 } }, new_text1.c_str(), new_text1.size()));
+
+    ws_mngr.did_change_file("test/library/test_wks/new_file", 3, changes1.data(), 1);
+
+    ASSERT_EQ(consumer.diags.diagnostics_size(), (size_t)1);
+    EXPECT_STREQ(consumer.diags.diagnostics(0).file_name(), "test/library/test_wks/faulty_file");
+}
+
+TEST(workspace_manager, memory_usage)
+{
+    workspace_manager ws_mngr;
+    ws_mngr.add_workspace("workspace", "test/library/test_wks");
+
+    std::string input = R"(
+         MACRO
+         MAC   &P
+         LR    &P,&P
+         MEND
+LBL      MAC   1
+)";
+    ws_mngr.did_open_file("test/library/test_wks/new_file", 1, input.c_str(), input.size());
+
+    auto usages = ws_mngr.memory_usage();
+    ASSERT_EQ(usages.size(), (size_t)1);
+    auto file = usages.item(0);
+    EXPECT_STREQ(file.document_uri, "test/library/test_wks/new_file");
+    EXPECT_TRUE(file.resident);
+    EXPECT_GT(file.usage.context, (size_t)0);
+    EXPECT_GT(file.usage.lsp, (size_t)0);
+    EXPECT_GT(file.usage.highlighting, (size_t)0);
+    EXPECT_GT(file.usage.tokens, (size_t)0);
+    // the macro is defined in the file
+    EXPECT_GT(file.usage.cached_statements, (size_t)0);
+    EXPECT_EQ(file.usage.total(),
+        file.usage.context + file.usage.lsp + file.usage.highlighting + file.usage.tokens
+            + file.usage.cached_statements);
+}
+
+TEST(workspace_manager, references_in_other_programs)
+{
+    auto root = std::filesystem::temp_directory_path() / "hlasm_references_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / ".hlasmplugin");
+    std::filesystem::create_directories(root / "lib");
+    std::ofstream(root / ".hlasmplugin" / "proc_grps.json")
+        << R"({ "pgroups": [ { "name": "P1", "libs": [ "lib" ] } ] })";
+    std::ofstream(root / ".hlasmplugin" / "pgm_conf.json")
+        << R"({ "pgms": [ { "program": "A", "pgroup": "P1" }, { "program": "B", "pgroup": "P1" } ] })";
+    std::ofstream(root / "lib" / "MAC") << " MACRO\n MAC\n MEND\n";
+    auto a = (root / "A").string();
+    auto b = (root / "B").string();
+
+    workspace_manager ws_mngr;
+    ws_mngr.add_workspace("workspace", root.string().c_str());
+
+    // the closed program stays in the index
+    std::string b_text = "\n MAC\n";
+    ws_mngr.did_open_file(b.c_str(), 1, b_text.c_str(), b_text.size());
+    ws_mngr.did_close_file(b.c_str());
+    std::string a_text = " MAC\n";
+    ws_mngr.did_open_file(a.c_str(), 1, a_text.c_str(), a_text.size());
+
+    auto refs = ws_mngr.references(a.c_str(), position(0, 1));
+    std::vector<std::pair<std::string, size_t>> found;
+    for (size_t i = 0; i < refs.size(); ++i)
+        found.emplace_back(refs.get_position_uri(i).uri(), (size_t)refs.get_position_uri(i).pos().line);
+    EXPECT_NE(std::find(found.begin(), found.end(), std::make_pair(a, (size_t)0)), found.end());
+    EXPECT_NE(std::find(found.begin(), found.end(), std::make_pair(b, (size_t)1)), found.end());
+
+    std::filesystem::remove_all(root);
+}